@@ -0,0 +1,198 @@
+#!/usr/bin/env python3
+
+###########################################################################
+#   fheroes2: https://github.com/ihhub/fheroes2                           #
+#   Copyright (C) 2026                                                    #
+#                                                                         #
+#   This program is free software; you can redistribute it and/or modify  #
+#   it under the terms of the GNU General Public License as published by  #
+#   the Free Software Foundation; either version 2 of the License, or     #
+#   (at your option) any later version.                                   #
+#                                                                         #
+#   This program is distributed in the hope that it will be useful,       #
+#   but WITHOUT ANY WARRANTY; without even the implied warranty of        #
+#   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         #
+#   GNU General Public License for more details.                          #
+#                                                                         #
+#   You should have received a copy of the GNU General Public License     #
+#   along with this program; if not, write to the                         #
+#   Free Software Foundation, Inc.,                                       #
+#   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             #
+###########################################################################
+
+# pylint: disable=missing-module-docstring
+
+import argparse
+import concurrent.futures
+import json
+import os
+import pathlib
+import subprocess
+import sys
+import time
+
+#
+# Runs many headless auto playtests in parallel worker processes. Every playthrough is
+# started as a separate fheroes2 process with its own seed:
+#
+# run_autoplaytest_batch.py --executable ./fheroes2 --games 1000 --jobs 16 maps/*.fh2m
+#
+# Results of every playthrough are written into <output>/<map name>/playthrough_<seed>.json
+# and a summary of the whole run is written into <output>/summary.json.
+#
+
+
+class CustomArgumentParser(
+    argparse.ArgumentParser
+):  # pylint: disable=missing-class-docstring
+    def error(self, message):
+        self.print_usage(sys.stderr)
+        self.exit(
+            1,
+            "%(prog)s: error: %(message)s\n" % {"prog": self.prog, "message": message},
+        )
+
+
+def parse_arguments():  # pylint: disable=missing-function-docstring
+    parser = CustomArgumentParser()
+
+    parser.add_argument("maps", nargs="+", help="*.fh2m map files to playtest")
+    parser.add_argument(
+        "--executable", default="./fheroes2", help="path to the fheroes2 executable"
+    )
+    parser.add_argument(
+        "--games", type=int, default=10, help="number of playthroughs per map"
+    )
+    parser.add_argument(
+        "--jobs",
+        type=int,
+        default=os.cpu_count() or 1,
+        help="number of playthroughs running at the same time",
+    )
+    parser.add_argument(
+        "--seed", type=int, default=0, help="seed of the first playthrough of every map"
+    )
+    parser.add_argument(
+        "--days", type=int, default=365, help="maximum number of days per playthrough"
+    )
+    parser.add_argument(
+        "--output", default="autoplaytest_results", help="directory for the results"
+    )
+
+    return parser.parse_args()
+
+
+def run_playthrough(
+    args, map_path, seed, output_dir
+):  # pylint: disable=missing-function-docstring
+    command = [
+        args.executable,
+        "--autoplaytest",
+        str(map_path),
+        "--seed",
+        str(seed),
+        "--days",
+        str(args.days),
+        "--output",
+        str(output_dir),
+    ]
+
+    completed = subprocess.run(
+        command, stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL, check=False
+    )
+    if completed.returncode != 0:
+        return None
+
+    with open(
+        output_dir / f"playthrough_{seed}.json", "r", encoding="utf-8"
+    ) as result_file:
+        return json.load(result_file)
+
+
+def summarize(results):  # pylint: disable=missing-function-docstring
+    summary = {}
+
+    for map_name, map_results in results.items():
+        wins = {}
+        finished_games = 0
+        total_days = 0
+        total_turns = 0
+        total_time = 0.0
+
+        for result in map_results:
+            total_days += result["days"]
+            total_turns += result["player_turns"]
+            total_time += result["wall_time_s"]
+
+            if result["time_limit_reached"]:
+                continue
+
+            finished_games += 1
+            for color in result["winners"]:
+                wins[color] = wins.get(color, 0) + 1
+
+        game_count = len(map_results)
+        summary[map_name] = {
+            "games": game_count,
+            "games_reached_time_limit": game_count - finished_games,
+            "win_rates": {
+                color: count / game_count for color, count in sorted(wins.items())
+            },
+            "average_days": total_days / game_count if game_count else 0,
+            "turns_per_s": total_turns / total_time if total_time > 0 else 0,
+        }
+
+    return summary
+
+
+def main():  # pylint: disable=missing-function-docstring
+    args = parse_arguments()
+
+    output_root = pathlib.Path(args.output)
+
+    start_time = time.monotonic()
+
+    results = {}
+    failures = 0
+
+    with concurrent.futures.ThreadPoolExecutor(max_workers=max(args.jobs, 1)) as pool:
+        futures = {}
+
+        for map_file in args.maps:
+            map_path = pathlib.Path(map_file)
+            output_dir = output_root / map_path.stem
+            output_dir.mkdir(parents=True, exist_ok=True)
+
+            results[map_path.stem] = []
+
+            for seed in range(args.seed, args.seed + args.games):
+                future = pool.submit(run_playthrough, args, map_path, seed, output_dir)
+                futures[future] = (map_path.stem, seed)
+
+        for future in concurrent.futures.as_completed(futures):
+            map_name, seed = futures[future]
+            result = future.result()
+
+            if result is None:
+                failures += 1
+                print(f"{map_name}: playthrough with seed {seed} failed", file=sys.stderr)
+                continue
+
+            results[map_name].append(result)
+
+    summary = {
+        "maps": summarize(results),
+        "failed_playthroughs": failures,
+        "wall_time_s": time.monotonic() - start_time,
+    }
+
+    with open(output_root / "summary.json", "w", encoding="utf-8") as summary_file:
+        json.dump(summary, summary_file, indent=2)
+
+    print(json.dumps(summary, indent=2))
+
+    return 1 if failures > 0 else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
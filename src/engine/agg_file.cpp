@@ -1,6 +1,6 @@
 /***************************************************************************
  *   fheroes2: https://github.com/ihhub/fheroes2                           *
- *   Copyright (C) 2020 - 2024                                             *
+ *   Copyright (C) 2020 - 2026                                             *
  *                                                                         *
  *   This program is free software; you can redistribute it and/or modify  *
  *   it under the terms of the GNU General Public License as published by  *
@@ -29,13 +29,41 @@ namespace fheroes2
 {
     bool AGGFile::open( const std::string & fileName )
     {
+        _files.clear();
+
+        const size_t fileRecordSize = sizeof( uint32_t ) * 3;
+
+        if ( _mappedFile.open( fileName ) ) {
+            const uint8_t * data = _mappedFile.data();
+            const size_t size = _mappedFile.size();
+
+            ROStreamBuf header( data, size );
+            const size_t count = header.getLE16();
+
+            if ( count * ( fileRecordSize + _maxFilenameSize ) >= size ) {
+                _mappedFile.close();
+                return false;
+            }
+
+            const size_t nameEntriesSize = _maxFilenameSize * count;
+            ROStreamBuf fileEntries( data + sizeof( uint16_t ), count * fileRecordSize );
+            ROStreamBuf nameEntries( data + size - nameEntriesSize, nameEntriesSize );
+
+            if ( !_readFileEntries( fileEntries, nameEntries, count ) ) {
+                _mappedFile.close();
+                return false;
+            }
+
+            return true;
+        }
+
+        // Memory mapping is not supported by the platform or has failed. Read the file on demand.
         if ( !_stream.open( fileName, "rb" ) ) {
             return false;
         }
 
         const size_t size = _stream.size();
         const size_t count = _stream.getLE16();
-        const size_t fileRecordSize = sizeof( uint32_t ) * 3;
 
         if ( count * ( fileRecordSize + _maxFilenameSize ) >= size ) {
             return false;
@@ -46,6 +74,15 @@ namespace fheroes2
         _stream.seek( size - nameEntriesSize );
         ROStreamBuf nameEntries = _stream.getStreamBuf( nameEntriesSize );
 
+        if ( !_readFileEntries( fileEntries, nameEntries, count ) ) {
+            return false;
+        }
+
+        return !_stream.fail();
+    }
+
+    bool AGGFile::_readFileEntries( ROStreamBuf & fileEntries, ROStreamBuf & nameEntries, const size_t count )
+    {
         for ( size_t i = 0; i < count; ++i ) {
             std::string name = nameEntries.getString( _maxFilenameSize );
 
@@ -66,10 +103,31 @@ namespace fheroes2
             return false;
         }
 
-        return !_stream.fail();
+        return true;
     }
 
     std::vector<uint8_t> AGGFile::read( const std::string & fileName )
+    {
+        if ( !_mappedFile.isOpen() ) {
+            auto it = _files.find( fileName );
+            if ( it == _files.end() ) {
+                return {};
+            }
+
+            const auto [fileSize, fileOffset] = it->second;
+            if ( fileSize > 0 ) {
+                _stream.seek( fileOffset );
+                return _stream.getRaw( fileSize );
+            }
+
+            return {};
+        }
+
+        const AGGFileData data = readData( fileName );
+        return { data.data(), data.data() + data.size() };
+    }
+
+    AGGFileData AGGFile::readData( const std::string & fileName )
     {
         auto it = _files.find( fileName );
         if ( it == _files.end() ) {
@@ -77,12 +135,21 @@ namespace fheroes2
         }
 
         const auto [fileSize, fileOffset] = it->second;
-        if ( fileSize > 0 ) {
-            _stream.seek( fileOffset );
-            return _stream.getRaw( fileSize );
+        if ( fileSize == 0 ) {
+            return {};
+        }
+
+        if ( _mappedFile.isOpen() ) {
+            if ( static_cast<size_t>( fileOffset ) + fileSize > _mappedFile.size() ) {
+                // The AGG file is corrupted.
+                return {};
+            }
+
+            return { _mappedFile.data() + fileOffset, fileSize };
         }
 
-        return {};
+        _stream.seek( fileOffset );
+        return AGGFileData( _stream.getRaw( fileSize ) );
     }
 
     uint32_t calculateAggFilenameHash( const std::string_view str )
@@ -1,6 +1,6 @@
 /***************************************************************************
  *   fheroes2: https://github.com/ihhub/fheroes2                           *
- *   Copyright (C) 2020 - 2025                                             *
+ *   Copyright (C) 2020 - 2026                                             *
  *                                                                         *
  *   This program is free software; you can redistribute it and/or modify  *
  *   it under the terms of the GNU General Public License as published by  *
@@ -29,24 +29,86 @@
 #include <utility>
 #include <vector>
 
+#include "memory_mapped_file.h"
 #include "serialize.h"
 
 namespace fheroes2
 {
+    // Content of a file stored within an AGG file. It refers directly to the memory-mapped AGG file if possible,
+    // otherwise it holds a copy of the content. In the first case the data is valid while the AGG file is open.
+    class AGGFileData
+    {
+    public:
+        AGGFileData() = default;
+
+        AGGFileData( const uint8_t * data, const size_t size )
+            : _data( data )
+            , _size( size )
+        {
+            // Do nothing.
+        }
+
+        explicit AGGFileData( std::vector<uint8_t> && buffer )
+            : _buffer( std::move( buffer ) )
+            , _data( _buffer.data() )
+            , _size( _buffer.size() )
+        {
+            // Do nothing.
+        }
+
+        // Moving a vector does not change the location of its data so the default move operations are safe.
+        AGGFileData( const AGGFileData & ) = delete;
+        AGGFileData( AGGFileData && ) = default;
+
+        ~AGGFileData() = default;
+
+        AGGFileData & operator=( const AGGFileData & ) = delete;
+        AGGFileData & operator=( AGGFileData && ) = default;
+
+        const uint8_t * data() const
+        {
+            return _data;
+        }
+
+        size_t size() const
+        {
+            return _size;
+        }
+
+        bool empty() const
+        {
+            return _size == 0;
+        }
+
+    private:
+        std::vector<uint8_t> _buffer;
+        const uint8_t * _data{ nullptr };
+        size_t _size{ 0 };
+    };
+
     class AGGFile
     {
     public:
         bool isGood() const
         {
-            return !_stream.fail() && !_files.empty();
+            return ( _mappedFile.isOpen() || !_stream.fail() ) && !_files.empty();
         }
 
+        // The file is mapped into memory if the platform supports it, otherwise it is read on demand.
         bool open( const std::string & fileName );
+
+        // Returns a copy of the file content.
         std::vector<uint8_t> read( const std::string & fileName );
 
+        // Returns the file content without copying it if the AGG file is mapped into memory.
+        AGGFileData readData( const std::string & fileName );
+
     private:
         static const size_t _maxFilenameSize = 15; // 8.3 ASCIIZ file name + 2-bytes padding
 
+        bool _readFileEntries( ROStreamBuf & fileEntries, ROStreamBuf & nameEntries, const size_t count );
+
+        MemoryMappedFile _mappedFile;
         StreamFile _stream;
         std::map<std::string, std::pair<uint32_t, uint32_t>, std::less<>> _files;
     };
@@ -0,0 +1,162 @@
+/***************************************************************************
+ *   fheroes2: https://github.com/ihhub/fheroes2                           *
+ *   Copyright (C) 2026                                                    *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include "dirty_region.h"
+
+#include <algorithm>
+#include <cassert>
+
+#include "math_tools.h"
+
+namespace fheroes2
+{
+    void DirtyRegion::resize( const int32_t width, const int32_t height )
+    {
+        assert( width >= 0 && height >= 0 );
+
+        _width = width;
+        _height = height;
+        _columns = ( width + cellSize - 1 ) / cellSize;
+        _rows = ( height + cellSize - 1 ) / cellSize;
+
+        _cells.assign( static_cast<size_t>( _columns ) * _rows, 0 );
+        _isEmpty = true;
+    }
+
+    void DirtyRegion::clear()
+    {
+        if ( _isEmpty ) {
+            return;
+        }
+
+        std::fill( _cells.begin(), _cells.end(), static_cast<uint8_t>( 0 ) );
+        _isEmpty = true;
+    }
+
+    void DirtyRegion::add( const Rect & roi )
+    {
+        const int32_t left = std::max( roi.x, 0 );
+        const int32_t top = std::max( roi.y, 0 );
+        const int32_t right = std::min( roi.x + roi.width, _width );
+        const int32_t bottom = std::min( roi.y + roi.height, _height );
+
+        if ( left >= right || top >= bottom ) {
+            return;
+        }
+
+        const int32_t firstColumn = left / cellSize;
+        const int32_t lastColumn = ( right - 1 ) / cellSize;
+        const int32_t lastRow = ( bottom - 1 ) / cellSize;
+
+        for ( int32_t row = top / cellSize; row <= lastRow; ++row ) {
+            uint8_t * cell = _cells.data() + static_cast<ptrdiff_t>( row ) * _columns;
+            std::fill( cell + firstColumn, cell + lastColumn + 1, static_cast<uint8_t>( 1 ) );
+        }
+
+        _isEmpty = false;
+    }
+
+    void DirtyRegion::add( const DirtyRegion & region )
+    {
+        assert( _width == region._width && _height == region._height );
+
+        if ( region._isEmpty ) {
+            return;
+        }
+
+        for ( size_t i = 0; i < _cells.size(); ++i ) {
+            _cells[i] |= region._cells[i];
+        }
+
+        _isEmpty = false;
+    }
+
+    std::vector<Rect> DirtyRegion::getRects() const
+    {
+        if ( _isEmpty ) {
+            return {};
+        }
+
+        // Horizontal runs of modified cells of the previous row. A run is merged with the rectangle created for the previous row
+        // if both have the same columns.
+        struct CellRun
+        {
+            int32_t firstColumn{ 0 };
+            int32_t endColumn{ 0 };
+            size_t rectId{ 0 };
+        };
+
+        std::vector<Rect> rects;
+        std::vector<CellRun> previousRuns;
+        std::vector<CellRun> currentRuns;
+
+        for ( int32_t row = 0; row < _rows; ++row ) {
+            const uint8_t * cells = _cells.data() + static_cast<ptrdiff_t>( row ) * _columns;
+            const int32_t rowBottom = std::min( ( row + 1 ) * cellSize, _height );
+
+            currentRuns.clear();
+
+            auto previousRun = previousRuns.cbegin();
+
+            for ( int32_t column = 0; column < _columns; ) {
+                if ( cells[column] == 0 ) {
+                    ++column;
+                    continue;
+                }
+
+                const int32_t firstColumn = column;
+                while ( column < _columns && cells[column] != 0 ) {
+                    ++column;
+                }
+
+                while ( previousRun != previousRuns.cend() && previousRun->firstColumn < firstColumn ) {
+                    ++previousRun;
+                }
+
+                if ( previousRun != previousRuns.cend() && previousRun->firstColumn == firstColumn && previousRun->endColumn == column ) {
+                    Rect & rect = rects[previousRun->rectId];
+                    rect.height = rowBottom - rect.y;
+
+                    currentRuns.push_back( { firstColumn, column, previousRun->rectId } );
+                    continue;
+                }
+
+                const int32_t left = firstColumn * cellSize;
+                const int32_t top = row * cellSize;
+                rects.emplace_back( left, top, std::min( column * cellSize, _width ) - left, rowBottom - top );
+
+                currentRuns.push_back( { firstColumn, column, rects.size() - 1 } );
+            }
+
+            std::swap( previousRuns, currentRuns );
+        }
+
+        if ( rects.size() > maxRectCount ) {
+            Rect boundary = rects.front();
+            for ( const Rect & rect : rects ) {
+                boundary = getBoundaryRect( boundary, rect );
+            }
+
+            return { boundary };
+        }
+
+        return rects;
+    }
+}
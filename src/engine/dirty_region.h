@@ -0,0 +1,71 @@
+/***************************************************************************
+ *   fheroes2: https://github.com/ihhub/fheroes2                           *
+ *   Copyright (C) 2026                                                    *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "math_base.h"
+
+namespace fheroes2
+{
+    // Tracks modified areas of an image using a grid of square cells. Modified cells are merged into a small set of non-overlapping rectangles
+    // so two small areas located far from each other do not cause the whole area between them to be updated.
+    class DirtyRegion
+    {
+    public:
+        static constexpr int32_t cellSize{ 64 };
+
+        // Every rectangle requires a separate texture update. If an area is too fragmented its bounding rectangle is used instead.
+        static constexpr size_t maxRectCount{ 16 };
+
+        // Resizing also clears the region.
+        void resize( const int32_t width, const int32_t height );
+
+        void clear();
+
+        bool empty() const
+        {
+            return _isEmpty;
+        }
+
+        // The area is clipped by the region boundaries.
+        void add( const Rect & roi );
+
+        // Both regions must have the same size.
+        void add( const DirtyRegion & region );
+
+        // Returns non-overlapping rectangles covering all modified cells. Rectangles are aligned to cells and clipped by the region boundaries.
+        std::vector<Rect> getRects() const;
+
+    private:
+        int32_t _width{ 0 };
+        int32_t _height{ 0 };
+        int32_t _columns{ 0 };
+        int32_t _rows{ 0 };
+
+        // One value per cell, non-zero for modified cells.
+        std::vector<uint8_t> _cells;
+
+        bool _isEmpty{ true };
+    };
+}
@@ -28,6 +28,7 @@
 
 #include "exception.h"
 #include "image_color_conversion.h"
+#include "image_kernels.h"
 #include "image_palette.h"
 
 #if defined( GENERATE_COLOR_TABLE )
@@ -1234,114 +1235,26 @@ namespace fheroes2
         const int32_t widthIn = in.width();
         const int32_t widthOut = out.width();
 
-        if ( flip ) {
-            const int32_t offsetInY = inY * widthIn + widthIn - 1 - inX;
-            const uint8_t * imageInY = in.image() + offsetInY;
-            const uint8_t * transformInY = in.transform() + offsetInY;
-
-            const int32_t offsetOutY = outY * widthOut + outX;
-            uint8_t * imageOutY = out.image() + offsetOutY;
-            const uint8_t * imageOutYEnd = imageOutY + height * widthOut;
-
-            if ( out.singleLayer() ) {
-                assert( !in.singleLayer() );
-                for ( ; imageOutY != imageOutYEnd; imageInY += widthIn, transformInY += widthIn, imageOutY += widthOut ) {
-                    const uint8_t * imageInX = imageInY;
-                    const uint8_t * transformInX = transformInY;
-                    uint8_t * imageOutX = imageOutY;
-                    const uint8_t * imageOutXEnd = imageOutX + width;
-
-                    for ( ; imageOutX != imageOutXEnd; --imageInX, --transformInX, ++imageOutX ) {
-                        if ( *transformInX > 0 ) { // apply a transformation
-                            if ( *transformInX != 1 ) { // skip pixel
-                                *imageOutX = *( transformTable + ( *transformInX ) * 256 + *imageOutX );
-                            }
-                        }
-                        else { // copy a pixel
-                            *imageOutX = *imageInX;
-                        }
-                    }
-                }
-            }
-            else {
-                uint8_t * transformOutY = out.transform() + offsetOutY;
-
-                for ( ; imageOutY != imageOutYEnd; imageInY += widthIn, transformInY += widthIn, imageOutY += widthOut, transformOutY += widthOut ) {
-                    const uint8_t * imageInX = imageInY;
-                    const uint8_t * transformInX = transformInY;
-                    uint8_t * imageOutX = imageOutY;
-                    uint8_t * transformOutX = transformOutY;
-                    const uint8_t * imageOutXEnd = imageOutX + width;
+        // For a flipped image each row is read backwards starting from its rightmost pixel.
+        const int32_t offsetInY = flip ? inY * widthIn + widthIn - 1 - inX : inY * widthIn + inX;
+        const uint8_t * imageInY = in.image() + offsetInY;
+        const uint8_t * transformInY = in.transform() + offsetInY;
 
-                    for ( ; imageOutX != imageOutXEnd; --imageInX, --transformInX, ++imageOutX, ++transformOutX ) {
-                        if ( *transformInX == 1 ) { // skip pixel
-                            continue;
-                        }
+        const int32_t offsetOutY = outY * widthOut + outX;
+        uint8_t * imageOutY = out.image() + offsetOutY;
+        const uint8_t * imageOutYEnd = imageOutY + height * widthOut;
 
-                        if ( *transformInX > 0 && *transformOutX == 0 ) { // apply a transformation
-                            *imageOutX = *( transformTable + ( *transformInX ) * 256 + *imageOutX );
-                        }
-                        else { // copy a pixel
-                            *transformOutX = *transformInX;
-                            *imageOutX = *imageInX;
-                        }
-                    }
-                }
+        if ( out.singleLayer() ) {
+            assert( !in.singleLayer() );
+            for ( ; imageOutY != imageOutYEnd; imageInY += widthIn, transformInY += widthIn, imageOutY += widthOut ) {
+                blitRow( imageInY, transformInY, imageOutY, nullptr, width, transformTable, flip );
             }
         }
         else {
-            const int32_t offsetInY = inY * widthIn + inX;
-            const uint8_t * imageInY = in.image() + offsetInY;
-            const uint8_t * transformInY = in.transform() + offsetInY;
-
-            const int32_t offsetOutY = outY * widthOut + outX;
-            uint8_t * imageOutY = out.image() + offsetOutY;
-            const uint8_t * imageInYEnd = imageInY + height * widthIn;
-
-            if ( out.singleLayer() ) {
-                assert( !in.singleLayer() );
-                for ( ; imageInY != imageInYEnd; imageInY += widthIn, transformInY += widthIn, imageOutY += widthOut ) {
-                    const uint8_t * imageInX = imageInY;
-                    const uint8_t * transformInX = transformInY;
-                    uint8_t * imageOutX = imageOutY;
-                    const uint8_t * imageInXEnd = imageInX + width;
-
-                    for ( ; imageInX != imageInXEnd; ++imageInX, ++transformInX, ++imageOutX ) {
-                        if ( *transformInX > 0 ) { // apply a transformation
-                            if ( *transformInX != 1 ) { // skip pixel
-                                *imageOutX = *( transformTable + ( *transformInX ) * 256 + *imageOutX );
-                            }
-                        }
-                        else { // copy a pixel
-                            *imageOutX = *imageInX;
-                        }
-                    }
-                }
-            }
-            else {
-                uint8_t * transformOutY = out.transform() + offsetOutY;
-
-                for ( ; imageInY != imageInYEnd; imageInY += widthIn, transformInY += widthIn, imageOutY += widthOut, transformOutY += widthOut ) {
-                    const uint8_t * imageInX = imageInY;
-                    const uint8_t * transformInX = transformInY;
-                    uint8_t * imageOutX = imageOutY;
-                    uint8_t * transformOutX = transformOutY;
-                    const uint8_t * imageInXEnd = imageInX + width;
-
-                    for ( ; imageInX != imageInXEnd; ++imageInX, ++transformInX, ++imageOutX, ++transformOutX ) {
-                        if ( *transformInX == 1 ) { // skip pixel
-                            continue;
-                        }
+            uint8_t * transformOutY = out.transform() + offsetOutY;
 
-                        if ( *transformInX > 0 && *transformOutX == 0 ) { // apply a transformation
-                            *imageOutX = *( transformTable + ( *transformInX ) * 256 + *imageOutX );
-                        }
-                        else { // copy a pixel
-                            *transformOutX = *transformInX;
-                            *imageOutX = *imageInX;
-                        }
-                    }
-                }
+            for ( ; imageOutY != imageOutYEnd; imageInY += widthIn, transformInY += widthIn, imageOutY += widthOut, transformOutY += widthOut ) {
+                blitRow( imageInY, transformInY, imageOutY, transformOutY, width, transformTable, flip );
             }
         }
     }
@@ -2117,51 +2030,6 @@ namespace fheroes2
         DrawLine( image, { roi.x, roi.y + roi.height - 1 }, { roi.x + roi.width, roi.y + roi.height - 1 }, value, roi );
     }
 
-    void DivideImageBySquares( const Point & spriteOffset, const Image & original, const int32_t squareSize, std::vector<Point> & outputSquareId,
-                               std::vector<std::pair<Point, Rect>> & outputImageInfo )
-    {
-        if ( original.empty() ) {
-            return;
-        }
-
-        if ( squareSize <= 0 ) {
-            assert( 0 );
-            return;
-        }
-
-        Point offset{ spriteOffset.x / squareSize, spriteOffset.y / squareSize };
-
-        // The start of a square must be before image offset so in case of negative offset we need to decrease the ID of the start square.
-        if ( ( spriteOffset.x < 0 ) && ( offset.x * squareSize != spriteOffset.x ) ) {
-            --offset.x;
-        }
-
-        if ( ( spriteOffset.y < 0 ) && ( offset.y * squareSize != spriteOffset.y ) ) {
-            --offset.y;
-        }
-
-        const Point spriteRelativeOffset{ spriteOffset.x - offset.x * squareSize, spriteOffset.y - offset.y * squareSize };
-        const Point stepPerDirection{ ( original.width() + spriteRelativeOffset.x + squareSize - 1 ) / squareSize,
-                                      ( original.height() + spriteRelativeOffset.y + squareSize - 1 ) / squareSize };
-        assert( stepPerDirection.x > 0 && stepPerDirection.y > 0 );
-
-        const Rect relativeROI( spriteRelativeOffset.x, spriteRelativeOffset.y, original.width(), original.height() );
-
-        for ( int32_t y = 0; y < stepPerDirection.y; ++y ) {
-            for ( int32_t x = 0; x < stepPerDirection.x; ++x ) {
-                const Rect roi( x * squareSize, y * squareSize, squareSize, squareSize );
-                const Rect intersection = relativeROI ^ roi;
-                assert( intersection.width > 0 && intersection.height > 0 );
-
-                outputSquareId.emplace_back( offset + Point( x, y ) );
-
-                outputImageInfo.emplace_back( fheroes2::Point( intersection.x - roi.x, intersection.y - roi.y ),
-                                              fheroes2::Rect( intersection.x - spriteRelativeOffset.x, intersection.y - spriteRelativeOffset.y, intersection.width,
-                                                              intersection.height ) );
-            }
-        }
-    }
-
     Image ExtractCommonPattern( const std::vector<const Image *> & input )
     {
         if ( input.empty() ) {
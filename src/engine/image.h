@@ -307,8 +307,49 @@ namespace fheroes2
 
     void DrawRect( Image & image, const Rect & roi, const uint8_t value );
 
-    void DivideImageBySquares( const Point & spriteOffset, const Image & original, const int32_t squareSize, std::vector<Point> & outputSquareId,
-                               std::vector<std::pair<Point, Rect>> & outputImageInfo );
+    // Divides the image placed at the given offset by squares and calls the handler for every square covered by the image
+    // with the square ID, the offset of the image part within the square and the area of the image part.
+    template <typename SquareHandler>
+    void DivideImageBySquares( const Point & spriteOffset, const Image & original, const int32_t squareSize, SquareHandler handler )
+    {
+        if ( original.empty() ) {
+            return;
+        }
+
+        if ( squareSize <= 0 ) {
+            assert( 0 );
+            return;
+        }
+
+        Point offset{ spriteOffset.x / squareSize, spriteOffset.y / squareSize };
+
+        // The start of a square must be before image offset so in case of negative offset we need to decrease the ID of the start square.
+        if ( ( spriteOffset.x < 0 ) && ( offset.x * squareSize != spriteOffset.x ) ) {
+            --offset.x;
+        }
+
+        if ( ( spriteOffset.y < 0 ) && ( offset.y * squareSize != spriteOffset.y ) ) {
+            --offset.y;
+        }
+
+        const Point spriteRelativeOffset{ spriteOffset.x - offset.x * squareSize, spriteOffset.y - offset.y * squareSize };
+        const Point stepPerDirection{ ( original.width() + spriteRelativeOffset.x + squareSize - 1 ) / squareSize,
+                                      ( original.height() + spriteRelativeOffset.y + squareSize - 1 ) / squareSize };
+        assert( stepPerDirection.x > 0 && stepPerDirection.y > 0 );
+
+        const Rect relativeROI( spriteRelativeOffset.x, spriteRelativeOffset.y, original.width(), original.height() );
+
+        for ( int32_t y = 0; y < stepPerDirection.y; ++y ) {
+            for ( int32_t x = 0; x < stepPerDirection.x; ++x ) {
+                const Rect roi( x * squareSize, y * squareSize, squareSize, squareSize );
+                const Rect intersection = relativeROI ^ roi;
+                assert( intersection.width > 0 && intersection.height > 0 );
+
+                handler( offset + Point( x, y ), Point( intersection.x - roi.x, intersection.y - roi.y ),
+                         Rect( intersection.x - spriteRelativeOffset.x, intersection.y - spriteRelativeOffset.y, intersection.width, intersection.height ) );
+            }
+        }
+    }
 
     // Every image in the array must be the same size. Make sure that pointers aren't nullptr!
     Image ExtractCommonPattern( const std::vector<const Image *> & input );
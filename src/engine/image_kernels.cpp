@@ -0,0 +1,419 @@
+/***************************************************************************
+ *   fheroes2: https://github.com/ihhub/fheroes2                           *
+ *   Copyright (C) 2026                                                    *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include "image_kernels.h"
+
+#include <cassert>
+#include <cstddef>
+
+#if defined( __x86_64__ ) || defined( __i386__ ) || defined( _M_X64 ) || defined( _M_IX86 )
+#define FHEROES2_X86_KERNELS
+#include <immintrin.h>
+#if defined( _MSC_VER )
+#include <intrin.h>
+#endif
+#elif defined( __aarch64__ ) || defined( _M_ARM64 )
+// NEON is a mandatory part of ARMv8-A so there is no need to check for it at runtime.
+#define FHEROES2_NEON_KERNELS
+#include <arm_neon.h>
+#endif
+
+#if defined( FHEROES2_X86_KERNELS ) && ( defined( __GNUC__ ) || defined( __clang__ ) )
+// GCC and Clang allow to use intrinsics only within functions compiled for the corresponding instruction set.
+#define KERNEL_TARGET( instructionSet ) __attribute__( ( target( instructionSet ) ) )
+#else
+#define KERNEL_TARGET( instructionSet )
+#endif
+
+namespace
+{
+    // The reference implementation. All other kernels must produce exactly the same results.
+    void blitScalar( const uint8_t * imageIn, const uint8_t * transformIn, uint8_t * imageOut, uint8_t * transformOut, int32_t x, const int32_t width,
+                     const uint8_t * transformTable, const bool isFlipped )
+    {
+        const ptrdiff_t inStep = isFlipped ? -1 : 1;
+        imageIn += inStep * x;
+        transformIn += inStep * x;
+
+        if ( transformOut == nullptr ) {
+            for ( ; x < width; ++x, imageIn += inStep, transformIn += inStep ) {
+                if ( *transformIn > 0 ) { // apply a transformation
+                    if ( *transformIn != 1 ) { // skip pixel
+                        imageOut[x] = *( transformTable + static_cast<ptrdiff_t>( *transformIn ) * 256 + imageOut[x] );
+                    }
+                }
+                else { // copy a pixel
+                    imageOut[x] = *imageIn;
+                }
+            }
+
+            return;
+        }
+
+        for ( ; x < width; ++x, imageIn += inStep, transformIn += inStep ) {
+            if ( *transformIn == 1 ) { // skip pixel
+                continue;
+            }
+
+            if ( *transformIn > 0 && transformOut[x] == 0 ) { // apply a transformation
+                imageOut[x] = *( transformTable + static_cast<ptrdiff_t>( *transformIn ) * 256 + imageOut[x] );
+            }
+            else { // copy a pixel
+                transformOut[x] = *transformIn;
+                imageOut[x] = *imageIn;
+            }
+        }
+    }
+
+    void expandPaletteScalar( const uint8_t * in, uint32_t * out, int32_t x, const int32_t width, const uint32_t * palette )
+    {
+        for ( ; x < width; ++x ) {
+            out[x] = palette[in[x]];
+        }
+    }
+
+    // All vector blit kernels below work in the same way. A chunk of pixels where every pixel is either copied or skipped (transform values 0 and 1)
+    // is processed by masked copying. Such chunks are the vast majority for sprites. Any chunk having pixels with other transform values
+    // (shadows and other effects) is passed to the scalar kernel as these pixels require per-pixel table lookups.
+
+#if defined( FHEROES2_X86_KERNELS )
+    KERNEL_TARGET( "sse2" ) __m128i loadSSE2( const uint8_t * data, const int32_t x, const bool isFlipped )
+    {
+        if ( !isFlipped ) {
+            return _mm_loadu_si128( reinterpret_cast<const __m128i *>( data + x ) );
+        }
+
+        // Load 16 bytes ending at the current position and reverse their order.
+        __m128i value = _mm_loadu_si128( reinterpret_cast<const __m128i *>( data - x - 15 ) );
+        value = _mm_or_si128( _mm_slli_epi16( value, 8 ), _mm_srli_epi16( value, 8 ) );
+        value = _mm_shufflelo_epi16( value, 0x1B );
+        value = _mm_shufflehi_epi16( value, 0x1B );
+        return _mm_shuffle_epi32( value, 0x4E );
+    }
+
+    KERNEL_TARGET( "sse2" )
+    void blitSSE2( const uint8_t * imageIn, const uint8_t * transformIn, uint8_t * imageOut, uint8_t * transformOut, int32_t x, const int32_t width,
+                   const uint8_t * transformTable, const bool isFlipped )
+    {
+        constexpr int32_t chunkSize = 16;
+        constexpr int fullMask = 0xFFFF;
+
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i one = _mm_set1_epi8( 1 );
+
+        for ( ; x + chunkSize <= width; x += chunkSize ) {
+            const __m128i transform = loadSSE2( transformIn, x, isFlipped );
+
+            if ( _mm_movemask_epi8( _mm_cmpeq_epi8( _mm_max_epu8( transform, one ), one ) ) != fullMask ) {
+                blitScalar( imageIn, transformIn, imageOut, transformOut, x, x + chunkSize, transformTable, isFlipped );
+                continue;
+            }
+
+            const __m128i isCopy = _mm_cmpeq_epi8( transform, zero );
+            const int copyMask = _mm_movemask_epi8( isCopy );
+            if ( copyMask == 0 ) {
+                // All pixels are skipped.
+                continue;
+            }
+
+            __m128i * outPtr = reinterpret_cast<__m128i *>( imageOut + x );
+            const __m128i in = loadSSE2( imageIn, x, isFlipped );
+
+            if ( copyMask == fullMask ) {
+                _mm_storeu_si128( outPtr, in );
+            }
+            else {
+                const __m128i out = _mm_loadu_si128( outPtr );
+                _mm_storeu_si128( outPtr, _mm_or_si128( _mm_and_si128( isCopy, in ), _mm_andnot_si128( isCopy, out ) ) );
+            }
+
+            if ( transformOut != nullptr ) {
+                __m128i * transformOutPtr = reinterpret_cast<__m128i *>( transformOut + x );
+                _mm_storeu_si128( transformOutPtr, _mm_andnot_si128( isCopy, _mm_loadu_si128( transformOutPtr ) ) );
+            }
+        }
+
+        blitScalar( imageIn, transformIn, imageOut, transformOut, x, width, transformTable, isFlipped );
+    }
+
+    KERNEL_TARGET( "avx2" ) __m256i loadAVX2( const uint8_t * data, const int32_t x, const bool isFlipped )
+    {
+        if ( !isFlipped ) {
+            return _mm256_loadu_si256( reinterpret_cast<const __m256i *>( data + x ) );
+        }
+
+        // Load 32 bytes ending at the current position, reverse bytes within each 128-bit lane and then swap the lanes.
+        const __m256i reverseMask = _mm256_setr_epi8( 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0 );
+        const __m256i value = _mm256_shuffle_epi8( _mm256_loadu_si256( reinterpret_cast<const __m256i *>( data - x - 31 ) ), reverseMask );
+        return _mm256_permute4x64_epi64( value, 0x4E );
+    }
+
+    KERNEL_TARGET( "avx2" )
+    void blitAVX2( const uint8_t * imageIn, const uint8_t * transformIn, uint8_t * imageOut, uint8_t * transformOut, int32_t x, const int32_t width,
+                   const uint8_t * transformTable, const bool isFlipped )
+    {
+        constexpr int32_t chunkSize = 32;
+        constexpr int fullMask = -1;
+
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i one = _mm256_set1_epi8( 1 );
+
+        for ( ; x + chunkSize <= width; x += chunkSize ) {
+            const __m256i transform = loadAVX2( transformIn, x, isFlipped );
+
+            if ( _mm256_movemask_epi8( _mm256_cmpeq_epi8( _mm256_max_epu8( transform, one ), one ) ) != fullMask ) {
+                blitScalar( imageIn, transformIn, imageOut, transformOut, x, x + chunkSize, transformTable, isFlipped );
+                continue;
+            }
+
+            const __m256i isCopy = _mm256_cmpeq_epi8( transform, zero );
+            const int copyMask = _mm256_movemask_epi8( isCopy );
+            if ( copyMask == 0 ) {
+                // All pixels are skipped.
+                continue;
+            }
+
+            __m256i * outPtr = reinterpret_cast<__m256i *>( imageOut + x );
+            const __m256i in = loadAVX2( imageIn, x, isFlipped );
+
+            if ( copyMask == fullMask ) {
+                _mm256_storeu_si256( outPtr, in );
+            }
+            else {
+                _mm256_storeu_si256( outPtr, _mm256_blendv_epi8( _mm256_loadu_si256( outPtr ), in, isCopy ) );
+            }
+
+            if ( transformOut != nullptr ) {
+                __m256i * transformOutPtr = reinterpret_cast<__m256i *>( transformOut + x );
+                _mm256_storeu_si256( transformOutPtr, _mm256_andnot_si256( isCopy, _mm256_loadu_si256( transformOutPtr ) ) );
+            }
+        }
+
+        // Do not call the SSE2 kernel here: switching between legacy SSE and AVX instructions is very slow on some CPUs.
+        blitScalar( imageIn, transformIn, imageOut, transformOut, x, width, transformTable, isFlipped );
+    }
+
+    KERNEL_TARGET( "avx2" ) void expandPaletteAVX2( const uint8_t * in, uint32_t * out, int32_t x, const int32_t width, const uint32_t * palette )
+    {
+        constexpr int32_t chunkSize = 8;
+
+        const int * table = reinterpret_cast<const int *>( palette );
+
+        for ( ; x + chunkSize <= width; x += chunkSize ) {
+            const __m256i indices = _mm256_cvtepu8_epi32( _mm_loadl_epi64( reinterpret_cast<const __m128i *>( in + x ) ) );
+            _mm256_storeu_si256( reinterpret_cast<__m256i *>( out + x ), _mm256_i32gather_epi32( table, indices, 4 ) );
+        }
+
+        expandPaletteScalar( in, out, x, width, palette );
+    }
+#endif
+
+#if defined( FHEROES2_NEON_KERNELS )
+    uint8x16_t loadNEON( const uint8_t * data, const int32_t x, const bool isFlipped )
+    {
+        if ( !isFlipped ) {
+            return vld1q_u8( data + x );
+        }
+
+        // Load 16 bytes ending at the current position, reverse bytes within each 64-bit half and then swap the halves.
+        const uint8x16_t value = vrev64q_u8( vld1q_u8( data - x - 15 ) );
+        return vextq_u8( value, value, 8 );
+    }
+
+    void blitNEON( const uint8_t * imageIn, const uint8_t * transformIn, uint8_t * imageOut, uint8_t * transformOut, int32_t x, const int32_t width,
+                   const uint8_t * transformTable, const bool isFlipped )
+    {
+        constexpr int32_t chunkSize = 16;
+
+        const uint8x16_t zero = vdupq_n_u8( 0 );
+
+        for ( ; x + chunkSize <= width; x += chunkSize ) {
+            const uint8x16_t transform = loadNEON( transformIn, x, isFlipped );
+
+            if ( vmaxvq_u8( transform ) > 1 ) {
+                blitScalar( imageIn, transformIn, imageOut, transformOut, x, x + chunkSize, transformTable, isFlipped );
+                continue;
+            }
+
+            const uint8x16_t isCopy = vceqq_u8( transform, zero );
+            if ( vmaxvq_u8( isCopy ) == 0 ) {
+                // All pixels are skipped.
+                continue;
+            }
+
+            const uint8x16_t in = loadNEON( imageIn, x, isFlipped );
+            vst1q_u8( imageOut + x, vbslq_u8( isCopy, in, vld1q_u8( imageOut + x ) ) );
+
+            if ( transformOut != nullptr ) {
+                vst1q_u8( transformOut + x, vbicq_u8( vld1q_u8( transformOut + x ), isCopy ) );
+            }
+        }
+
+        blitScalar( imageIn, transformIn, imageOut, transformOut, x, width, transformTable, isFlipped );
+    }
+#endif
+
+    fheroes2::InstructionSet detectBestInstructionSet()
+    {
+#if defined( FHEROES2_X86_KERNELS )
+#if defined( _MSC_VER ) && !defined( __clang__ )
+        int info[4] = { 0 };
+        __cpuid( info, 0 );
+        const int maxLeaf = info[0];
+
+        __cpuid( info, 1 );
+        const bool hasSSE2 = ( info[3] & ( 1 << 26 ) ) != 0;
+        // AVX registers must be also enabled by the operating system.
+        const bool isAVXEnabled = ( info[2] & ( 1 << 27 ) ) != 0 && ( info[2] & ( 1 << 28 ) ) != 0 && ( _xgetbv( 0 ) & 0x6 ) == 0x6;
+
+        bool hasAVX2 = false;
+        if ( isAVXEnabled && maxLeaf >= 7 ) {
+            __cpuidex( info, 7, 0 );
+            hasAVX2 = ( info[1] & ( 1 << 5 ) ) != 0;
+        }
+#else
+        __builtin_cpu_init();
+        const bool hasSSE2 = __builtin_cpu_supports( "sse2" );
+        const bool hasAVX2 = __builtin_cpu_supports( "avx2" );
+#endif
+        if ( hasAVX2 ) {
+            return fheroes2::InstructionSet::AVX2;
+        }
+
+        if ( hasSSE2 ) {
+            return fheroes2::InstructionSet::SSE2;
+        }
+#elif defined( FHEROES2_NEON_KERNELS )
+        return fheroes2::InstructionSet::NEON;
+#endif
+        return fheroes2::InstructionSet::SCALAR;
+    }
+
+    fheroes2::InstructionSet getBestInstructionSet()
+    {
+        static const fheroes2::InstructionSet bestInstructionSet = detectBestInstructionSet();
+        return bestInstructionSet;
+    }
+
+    fheroes2::InstructionSet & currentInstructionSet()
+    {
+        static fheroes2::InstructionSet instructionSet = getBestInstructionSet();
+        return instructionSet;
+    }
+}
+
+namespace fheroes2
+{
+    const char * getInstructionSetName( const InstructionSet instructionSet )
+    {
+        switch ( instructionSet ) {
+        case InstructionSet::SCALAR:
+            return "scalar";
+        case InstructionSet::SSE2:
+            return "SSE2";
+        case InstructionSet::AVX2:
+            return "AVX2";
+        case InstructionSet::NEON:
+            return "NEON";
+        default:
+            // Did you add a new instruction set? Add the logic above!
+            assert( 0 );
+            break;
+        }
+
+        return "unknown";
+    }
+
+    bool isInstructionSetSupported( const InstructionSet instructionSet )
+    {
+        const InstructionSet best = getBestInstructionSet();
+
+        switch ( instructionSet ) {
+        case InstructionSet::SCALAR:
+            return true;
+        case InstructionSet::SSE2:
+            return best == InstructionSet::SSE2 || best == InstructionSet::AVX2;
+        case InstructionSet::AVX2:
+        case InstructionSet::NEON:
+            return best == instructionSet;
+        default:
+            // Did you add a new instruction set? Add the logic above!
+            assert( 0 );
+            break;
+        }
+
+        return false;
+    }
+
+    bool setImageInstructionSet( const InstructionSet instructionSet )
+    {
+        if ( !isInstructionSetSupported( instructionSet ) ) {
+            return false;
+        }
+
+        currentInstructionSet() = instructionSet;
+        return true;
+    }
+
+    InstructionSet getImageInstructionSet()
+    {
+        return currentInstructionSet();
+    }
+
+    void blitRow( const uint8_t * imageIn, const uint8_t * transformIn, uint8_t * imageOut, uint8_t * transformOut, const int32_t width,
+                  const uint8_t * transformTable, const bool isFlipped )
+    {
+        assert( imageIn != nullptr && transformIn != nullptr && imageOut != nullptr && transformTable != nullptr && width >= 0 );
+
+        switch ( currentInstructionSet() ) {
+#if defined( FHEROES2_X86_KERNELS )
+        case InstructionSet::AVX2:
+            blitAVX2( imageIn, transformIn, imageOut, transformOut, 0, width, transformTable, isFlipped );
+            return;
+        case InstructionSet::SSE2:
+            blitSSE2( imageIn, transformIn, imageOut, transformOut, 0, width, transformTable, isFlipped );
+            return;
+#endif
+#if defined( FHEROES2_NEON_KERNELS )
+        case InstructionSet::NEON:
+            blitNEON( imageIn, transformIn, imageOut, transformOut, 0, width, transformTable, isFlipped );
+            return;
+#endif
+        default:
+            break;
+        }
+
+        blitScalar( imageIn, transformIn, imageOut, transformOut, 0, width, transformTable, isFlipped );
+    }
+
+    void expandPaletteRow( const uint8_t * in, uint32_t * out, const int32_t width, const uint32_t * palette )
+    {
+        assert( in != nullptr && out != nullptr && palette != nullptr && width >= 0 );
+
+#if defined( FHEROES2_X86_KERNELS )
+        if ( currentInstructionSet() == InstructionSet::AVX2 ) {
+            expandPaletteAVX2( in, out, 0, width, palette );
+            return;
+        }
+#endif
+
+        expandPaletteScalar( in, out, 0, width, palette );
+    }
+}
@@ -0,0 +1,59 @@
+/***************************************************************************
+ *   fheroes2: https://github.com/ihhub/fheroes2                           *
+ *   Copyright (C) 2026                                                    *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+
+namespace fheroes2
+{
+    enum class InstructionSet : uint8_t
+    {
+        SCALAR,
+        SSE2,
+        AVX2,
+        NEON
+    };
+
+    const char * getInstructionSetName( const InstructionSet instructionSet );
+
+    // Returns true if the instruction set is supported by both the CPU and the compiler used to build the application.
+    bool isInstructionSetSupported( const InstructionSet instructionSet );
+
+    // By default image kernels use the most advanced supported instruction set. It can be changed, for example, for benchmarking.
+    // Returns false and keeps the current instruction set if the requested one is not supported.
+    bool setImageInstructionSet( const InstructionSet instructionSet );
+
+    InstructionSet getImageInstructionSet();
+
+    // Blits one row of a two-layer image into another image following the rules of fheroes2::Blit() function:
+    // - a transform value of 0 copies the pixel
+    // - a transform value of 1 skips the pixel
+    // - other transform values apply the transform table to the output pixel
+    // 'transformOut' must be nullptr for single-layer output images.
+    // For flipped rows 'imageIn' and 'transformIn' point to the rightmost input pixel and the row is read backwards.
+    // All instruction sets produce identical results.
+    void blitRow( const uint8_t * imageIn, const uint8_t * transformIn, uint8_t * imageOut, uint8_t * transformOut, const int32_t width,
+                  const uint8_t * transformTable, const bool isFlipped );
+
+    // Converts one row of 8-bit palette indices into 32-bit pixels using the given palette of 256 entries.
+    // Only AVX2 has gather instructions so all other instruction sets use the scalar kernel.
+    void expandPaletteRow( const uint8_t * in, uint32_t * out, const int32_t width, const uint32_t * palette );
+}
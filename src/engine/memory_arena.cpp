@@ -0,0 +1,89 @@
+/***************************************************************************
+ *   fheroes2: https://github.com/ihhub/fheroes2                           *
+ *   Copyright (C) 2026                                                    *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include "memory_arena.h"
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
+namespace fheroes2
+{
+    MemoryArena::MemoryArena( const size_t blockSize )
+        : _blockSize( blockSize )
+    {
+        assert( blockSize > 0 );
+    }
+
+    void * MemoryArena::allocate( const size_t size, const size_t alignment )
+    {
+        assert( alignment > 0 && ( alignment & ( alignment - 1 ) ) == 0 );
+
+        while ( _currentBlockId < _blocks.size() ) {
+            Block & block = _blocks[_currentBlockId];
+
+            const uintptr_t blockStart = reinterpret_cast<uintptr_t>( block.data.get() );
+            const uintptr_t alignedAddress = ( blockStart + _currentBlockOffset + alignment - 1 ) & ~static_cast<uintptr_t>( alignment - 1 );
+            const size_t offset = static_cast<size_t>( alignedAddress - blockStart );
+
+            if ( offset <= block.size && size <= block.size - offset ) {
+                _currentBlockOffset = offset + size;
+                return block.data.get() + offset;
+            }
+
+            // Remaining memory of this block is not enough. It is left unused until the next reset.
+            ++_currentBlockId;
+            _currentBlockOffset = 0;
+        }
+
+        // The block must fit the requested size regardless of the alignment of its start.
+        _addBlock( std::max( _blockSize, size + alignment ) );
+
+        return allocate( size, alignment );
+    }
+
+    void MemoryArena::reset()
+    {
+        if ( _blocks.size() > 1 ) {
+            size_t totalSize = 0;
+            for ( const Block & block : _blocks ) {
+                totalSize += block.size;
+            }
+
+            _blocks.clear();
+            _addBlock( totalSize );
+        }
+
+        _currentBlockId = 0;
+        _currentBlockOffset = 0;
+        _heapAllocationCount = 0;
+    }
+
+    void MemoryArena::_addBlock( const size_t size )
+    {
+        Block block;
+        block.data = std::make_unique<uint8_t[]>( size );
+        block.size = size;
+
+        _blocks.emplace_back( std::move( block ) );
+
+        ++_heapAllocationCount;
+    }
+}
@@ -0,0 +1,134 @@
+/***************************************************************************
+ *   fheroes2: https://github.com/ihhub/fheroes2                           *
+ *   Copyright (C) 2026                                                    *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace fheroes2
+{
+    // Monotonic memory arena for short-lived containers, for example, the ones used to render a single frame. Memory is taken from big blocks
+    // and it is never released separately. Instead, all allocations are released at once by resetting the arena.
+    class MemoryArena final
+    {
+    public:
+        explicit MemoryArena( const size_t blockSize );
+
+        // A copy does not share memory with the original arena. It starts empty with the same block size.
+        MemoryArena( const MemoryArena & arena )
+            : MemoryArena( arena._blockSize )
+        {
+            // Do nothing.
+        }
+
+        ~MemoryArena() = default;
+
+        MemoryArena & operator=( const MemoryArena & ) = delete;
+
+        // The alignment must be a power of 2.
+        void * allocate( const size_t size, const size_t alignment );
+
+        // Releases all allocations. Nothing allocated from the arena before this call can be used after it.
+        // If more than one block was needed since the previous reset, all blocks are replaced by a single block of their total size
+        // so the same amount of allocations does not require any heap allocations next time.
+        void reset();
+
+        // Returns the number of heap allocations since the previous reset.
+        size_t getHeapAllocationCount() const
+        {
+            return _heapAllocationCount;
+        }
+
+    private:
+        struct Block
+        {
+            std::unique_ptr<uint8_t[]> data;
+            size_t size{ 0 };
+        };
+
+        void _addBlock( const size_t size );
+
+        std::vector<Block> _blocks;
+
+        const size_t _blockSize;
+
+        size_t _currentBlockId{ 0 };
+        size_t _currentBlockOffset{ 0 };
+
+        size_t _heapAllocationCount{ 0 };
+    };
+
+    // Allocator for standard containers which takes memory from an arena. Deallocation does nothing.
+    template <typename T>
+    class ArenaAllocator
+    {
+    public:
+        using value_type = T;
+
+        explicit ArenaAllocator( MemoryArena & arena )
+            : _arena( &arena )
+        {
+            // Do nothing.
+        }
+
+        template <typename U>
+        ArenaAllocator( const ArenaAllocator<U> & allocator )
+            : _arena( &allocator.getArena() )
+        {
+            // Do nothing.
+        }
+
+        T * allocate( const size_t count )
+        {
+            return static_cast<T *>( _arena->allocate( count * sizeof( T ), alignof( T ) ) );
+        }
+
+        void deallocate( T * /* unused */, const size_t /* unused */ )
+        {
+            // Memory is released by resetting the arena.
+        }
+
+        MemoryArena & getArena() const
+        {
+            return *_arena;
+        }
+
+        template <typename U>
+        bool operator==( const ArenaAllocator<U> & allocator ) const
+        {
+            return _arena == &allocator.getArena();
+        }
+
+        template <typename U>
+        bool operator!=( const ArenaAllocator<U> & allocator ) const
+        {
+            return !operator==( allocator );
+        }
+
+    private:
+        MemoryArena * _arena;
+    };
+
+    template <typename T>
+    using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+}
@@ -0,0 +1,125 @@
+/***************************************************************************
+ *   fheroes2: https://github.com/ihhub/fheroes2                           *
+ *   Copyright (C) 2026                                                    *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include "memory_mapped_file.h"
+
+#include <ostream>
+
+#if defined( _WIN32 )
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#elif !defined( TARGET_PS_VITA ) && !defined( TARGET_NINTENDO_SWITCH ) && !defined( __EMSCRIPTEN__ )
+#define MEMORY_MAPPING_POSIX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "logging.h"
+
+bool MemoryMappedFile::open( const std::string & fileName )
+{
+    close();
+
+#if defined( _WIN32 )
+    const HANDLE file = CreateFileA( fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr );
+    if ( file == INVALID_HANDLE_VALUE ) {
+        return false;
+    }
+
+    LARGE_INTEGER fileSize;
+    if ( !GetFileSizeEx( file, &fileSize ) || fileSize.QuadPart <= 0 || static_cast<unsigned long long>( fileSize.QuadPart ) > SIZE_MAX ) {
+        CloseHandle( file );
+        return false;
+    }
+
+    // The file handle is not needed after the mapping object is created.
+    const HANDLE mapping = CreateFileMappingA( file, nullptr, PAGE_READONLY, 0, 0, nullptr );
+    CloseHandle( file );
+
+    if ( mapping == nullptr ) {
+        ERROR_LOG( "Error mapping file " << fileName << " into memory" )
+        return false;
+    }
+
+    const void * data = MapViewOfFile( mapping, FILE_MAP_READ, 0, 0, 0 );
+    if ( data == nullptr ) {
+        ERROR_LOG( "Error mapping file " << fileName << " into memory" )
+        CloseHandle( mapping );
+        return false;
+    }
+
+    _mapping = mapping;
+    _data = static_cast<const uint8_t *>( data );
+    _size = static_cast<size_t>( fileSize.QuadPart );
+
+    return true;
+#elif defined( MEMORY_MAPPING_POSIX )
+    const int file = ::open( fileName.c_str(), O_RDONLY );
+    if ( file < 0 ) {
+        return false;
+    }
+
+    struct stat fileInfo;
+    if ( fstat( file, &fileInfo ) != 0 || fileInfo.st_size <= 0 ) {
+        ::close( file );
+        return false;
+    }
+
+    const size_t fileSize = static_cast<size_t>( fileInfo.st_size );
+
+    // The mapping stays valid after the file descriptor is closed.
+    void * data = mmap( nullptr, fileSize, PROT_READ, MAP_PRIVATE, file, 0 );
+    ::close( file );
+
+    if ( data == MAP_FAILED ) {
+        ERROR_LOG( "Error mapping file " << fileName << " into memory" )
+        return false;
+    }
+
+    _data = static_cast<const uint8_t *>( data );
+    _size = fileSize;
+
+    return true;
+#else
+    (void)fileName;
+
+    return false;
+#endif
+}
+
+void MemoryMappedFile::close()
+{
+    if ( _data == nullptr ) {
+        return;
+    }
+
+#if defined( _WIN32 )
+    UnmapViewOfFile( _data );
+    CloseHandle( _mapping );
+    _mapping = nullptr;
+#elif defined( MEMORY_MAPPING_POSIX )
+    munmap( const_cast<uint8_t *>( _data ), _size );
+#endif
+
+    _data = nullptr;
+    _size = 0;
+}
@@ -0,0 +1,69 @@
+/***************************************************************************
+ *   fheroes2: https://github.com/ihhub/fheroes2                           *
+ *   Copyright (C) 2026                                                    *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Read-only view of a whole file mapped into memory. The operating system loads only the accessed pages of the file
+// and can discard them at any time so large files do not occupy application memory.
+class MemoryMappedFile
+{
+public:
+    MemoryMappedFile() = default;
+    MemoryMappedFile( const MemoryMappedFile & ) = delete;
+
+    ~MemoryMappedFile()
+    {
+        close();
+    }
+
+    MemoryMappedFile & operator=( const MemoryMappedFile & ) = delete;
+
+    // Returns false if the file cannot be opened or mapped, if it is empty or if memory mapping is not supported by the platform.
+    bool open( const std::string & fileName );
+
+    void close();
+
+    bool isOpen() const
+    {
+        return _data != nullptr;
+    }
+
+    const uint8_t * data() const
+    {
+        return _data;
+    }
+
+    size_t size() const
+    {
+        return _size;
+    }
+
+private:
+    const uint8_t * _data{ nullptr };
+    size_t _size{ 0 };
+
+#if defined( _WIN32 )
+    void * _mapping{ nullptr };
+#endif
+};
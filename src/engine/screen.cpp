@@ -21,12 +21,15 @@
 #include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <iterator>
+#include <memory>
 #include <optional>
 #include <ostream>
 #include <set>
+#include <thread>
 #include <utility>
 
 // Managing compiler warnings for SDL headers
@@ -59,14 +62,18 @@
 #include <vita2d.h>
 #endif
 
+#include "image_kernels.h"
 #include "image_palette.h"
 #include "logging.h"
-#include "math_tools.h"
 #include "screen.h"
 #include "system.h"
+#include "thread.h"
+#include "timing.h"
 
 namespace
 {
+    bool isHeadlessModeEnabled{ false };
+
     // Returns nearest screen supported resolution
     fheroes2::ResolutionInfo GetNearestResolution( fheroes2::ResolutionInfo resolutionInfo, const std::vector<fheroes2::ResolutionInfo> & resolutions )
     {
@@ -273,6 +280,50 @@ namespace
         std::vector<uint32_t> _palette32Bit;
         std::vector<SDL_Color> _palette8Bit;
 
+        // Worker threads for conversion of large areas of 8-bit image into 32-bit surface. They are created on the first use.
+        std::unique_ptr<MultiThreading::WorkerPool> _conversionWorkerPool;
+
+        // Converts an area of 8-bit image into 32-bit pixels. Both input and output rows are located 'stride' pixels apart.
+        // Large areas are split into stripes of rows which are converted by multiple threads.
+        void expandPalette( const uint8_t * in, uint32_t * out, const int32_t stride, const int32_t width, const int32_t height )
+        {
+            assert( _palette32Bit.size() == 256 );
+
+            const uint32_t * palette = _palette32Bit.data();
+
+            const auto expandRows = [in, out, stride, width, palette]( const int32_t startRow, const int32_t endRow ) {
+                for ( int32_t y = startRow; y < endRow; ++y ) {
+                    const ptrdiff_t offset = static_cast<ptrdiff_t>( y ) * stride;
+                    fheroes2::expandPaletteRow( in + offset, out + offset, width, palette );
+                }
+            };
+
+            // Starting threads for small areas takes more time than the conversion itself.
+            const int64_t minPixelsForMultiThreading{ 1920 * 1080 };
+            const size_t maxConversionThreadCount{ 8 };
+
+            const size_t threadCount = std::min<size_t>( std::thread::hardware_concurrency(), maxConversionThreadCount );
+            if ( threadCount < 2 || static_cast<int64_t>( width ) * height < minPixelsForMultiThreading ) {
+                expandRows( 0, height );
+                return;
+            }
+
+            if ( !_conversionWorkerPool ) {
+                _conversionWorkerPool = std::make_unique<MultiThreading::WorkerPool>( threadCount );
+            }
+
+            const size_t stripeCount = _conversionWorkerPool->getWorkerCount();
+            const int32_t stripeHeight = ( height + static_cast<int32_t>( stripeCount ) - 1 ) / static_cast<int32_t>( stripeCount );
+
+            _conversionWorkerPool->execute(
+                stripeCount,
+                [&expandRows, stripeHeight, height]( const size_t taskId, const size_t /* workerId */ ) {
+                    const int32_t startRow = static_cast<int32_t>( taskId ) * stripeHeight;
+                    expandRows( std::min( startRow, height ), std::min( startRow + stripeHeight, height ) );
+                },
+                {} );
+        }
+
         void copyImageToSurface( const fheroes2::Image & image, SDL_Surface * surface, const fheroes2::Rect & roi )
         {
             assert( surface != nullptr && !image.empty() );
@@ -293,13 +344,7 @@ namespace
 
             if ( fullFrame ) {
                 if ( surface->format->BitsPerPixel == 32 ) {
-                    uint32_t * out = static_cast<uint32_t *>( surface->pixels );
-                    const uint32_t * outEnd = out + imageWidth * imageHeight;
-                    const uint8_t * in = imageIn;
-                    const uint32_t * transform = _palette32Bit.data();
-
-                    for ( ; out != outEnd; ++out, ++in )
-                        *out = *( transform + *in );
+                    expandPalette( imageIn, static_cast<uint32_t *>( surface->pixels ), imageWidth, imageWidth, imageHeight );
                 }
                 else if ( ( surface->format->BitsPerPixel == 8 ) && ( surface->pixels != imageIn ) ) {
                     if ( imageWidth % 4 != 0 ) {
@@ -315,19 +360,7 @@ namespace
             }
             else {
                 if ( surface->format->BitsPerPixel == 32 ) {
-                    uint32_t * outY = static_cast<uint32_t *>( surface->pixels );
-                    const uint32_t * outYEnd = outY + imageWidth * roi.height;
-                    const uint8_t * inY = imageIn + roi.x + roi.y * imageWidth;
-                    const uint32_t * transform = _palette32Bit.data();
-
-                    for ( ; outY != outYEnd; outY += imageWidth, inY += imageWidth ) {
-                        uint32_t * outX = outY;
-                        const uint32_t * outXEnd = outX + roi.width;
-                        const uint8_t * inX = inY;
-
-                        for ( ; outX != outXEnd; ++outX, ++inX )
-                            *outX = *( transform + *inX );
-                    }
+                    expandPalette( imageIn + roi.x + roi.y * imageWidth, static_cast<uint32_t *>( surface->pixels ), imageWidth, roi.width, roi.height );
                 }
                 else if ( ( surface->format->BitsPerPixel == 8 ) && ( surface->pixels != imageIn ) ) {
                     const int32_t screenWidth = ( imageWidth / 4 ) * 4 + 4;
@@ -717,9 +750,9 @@ namespace
             return true;
         }
 
-        void render( const fheroes2::Display & display, const fheroes2::Rect & roi ) override
+        void render( const fheroes2::Display & display, const std::vector<fheroes2::Rect> & rois ) override
         {
-            (void)roi;
+            (void)rois;
 
             if ( _texBuffer == nullptr )
                 return;
@@ -1118,7 +1151,7 @@ namespace
             _windowedSize = {};
         }
 
-        void render( const fheroes2::Display & display, const fheroes2::Rect & roi ) override
+        void render( const fheroes2::Display & display, const std::vector<fheroes2::Rect> & rois ) override
         {
             if ( _surface == nullptr ) {
                 return;
@@ -1126,25 +1159,29 @@ namespace
 
             assert( _renderer != nullptr && _texture != nullptr );
 
-            copyImageToSurface( display, _surface, roi );
+            // Only modified areas are uploaded to the texture. Each area is copied to the surface and uploaded separately
+            // as partial copying uses the beginning of the surface as a temporary buffer.
+            for ( const fheroes2::Rect & roi : rois ) {
+                copyImageToSurface( display, _surface, roi );
 
-            const bool fullFrame = ( roi.width == display.width() ) && ( roi.height == display.height() );
-            if ( fullFrame ) {
-                const int returnCode = SDL_UpdateTexture( _texture, nullptr, _surface->pixels, _surface->pitch );
-                if ( returnCode < 0 ) {
-                    ERROR_LOG( "Failed to update texture. The error value: " << returnCode << ", description: " << SDL_GetError() )
+                const bool fullFrame = ( roi.width == display.width() ) && ( roi.height == display.height() );
+                if ( fullFrame ) {
+                    const int returnCode = SDL_UpdateTexture( _texture, nullptr, _surface->pixels, _surface->pitch );
+                    if ( returnCode < 0 ) {
+                        ERROR_LOG( "Failed to update texture. The error value: " << returnCode << ", description: " << SDL_GetError() )
+                    }
                 }
-            }
-            else {
-                SDL_Rect area;
-                area.x = roi.x;
-                area.y = roi.y;
-                area.w = roi.width;
-                area.h = roi.height;
+                else {
+                    SDL_Rect area;
+                    area.x = roi.x;
+                    area.y = roi.y;
+                    area.w = roi.width;
+                    area.h = roi.height;
 
-                const int returnCode = SDL_UpdateTexture( _texture, &area, _surface->pixels, _surface->pitch );
-                if ( returnCode < 0 ) {
-                    ERROR_LOG( "Failed to update texture. The error value: " << returnCode << ", description: " << SDL_GetError() )
+                    const int returnCode = SDL_UpdateTexture( _texture, &area, _surface->pixels, _surface->pitch );
+                    if ( returnCode < 0 ) {
+                        ERROR_LOG( "Failed to update texture. The error value: " << returnCode << ", description: " << SDL_GetError() )
+                    }
                 }
             }
 
@@ -1440,9 +1477,17 @@ namespace fheroes2
     }
 
     Display::Display()
-        : _engine( RenderEngine::create() )
-        , _cursor( RenderCursor::create() )
     {
+        if ( isHeadlessModeEnabled ) {
+            // Default implementations of the render engine and cursor do nothing.
+            _engine.reset( new BaseRenderEngine );
+            _cursor.reset( new Cursor );
+        }
+        else {
+            _engine.reset( RenderEngine::create() );
+            _cursor.reset( RenderCursor::create() );
+        }
+
         _disableTransformLayer();
     }
 
@@ -1467,7 +1512,7 @@ namespace fheroes2
         // deallocate engine resources
         _engine->clear();
 
-        _prevRoi = {};
+        _prevRegion.clear();
 
         // allocate engine resources
         if ( !_engine->allocate( info, isFullScreen ) ) {
@@ -1477,6 +1522,9 @@ namespace fheroes2
         Image::resize( info.gameWidth, info.gameHeight );
         Image::reset();
 
+        _prevRegion.resize( info.gameWidth, info.gameHeight );
+        _currentRegion.resize( info.gameWidth, info.gameHeight );
+
         _screenSize = { info.screenWidth, info.screenHeight };
     }
 
@@ -1487,7 +1535,7 @@ namespace fheroes2
         // deallocate engine resources
         _engine->clear();
 
-        _prevRoi = {};
+        _prevRegion.clear();
 
         ResolutionInfo res( width(), height(), _screenSize.width, _screenSize.height );
 
@@ -1508,6 +1556,11 @@ namespace fheroes2
         return display;
     }
 
+    void Display::enableHeadlessMode()
+    {
+        isHeadlessModeEnabled = true;
+    }
+
     void Display::render( const Rect & roi )
     {
         Rect temp( roi );
@@ -1515,6 +1568,9 @@ namespace fheroes2
             return;
         }
 
+        _currentRegion.clear();
+        _currentRegion.add( temp );
+
         if ( _cursor->isVisible() && _cursor->isSoftwareEmulation() && !_cursor->_image.empty() ) {
             const Sprite & cursorImage = _cursor->_image;
             Rect cursorROI( cursorImage.x(), cursorImage.y(), cursorImage.width(), cursorImage.height() );
@@ -1527,12 +1583,12 @@ namespace fheroes2
             const Sprite backup = Crop( *this, cursorROI.x, cursorROI.y, cursorROI.width, cursorROI.height );
             Blit( cursorImage, 0, 0, *this, cursorROI.x, cursorROI.y, cursorROI.width, cursorROI.height );
 
-            // ROI must include cursor's area as well, otherwise cursor won't be rendered.
-            if ( !backup.empty() && getActiveArea( cursorROI, width(), height() ) ) {
-                temp = getBoundaryRect( temp, cursorROI );
+            // The rendered area must include cursor's area as well, otherwise cursor won't be rendered.
+            if ( !backup.empty() ) {
+                _currentRegion.add( cursorROI );
             }
 
-            _renderFrame( temp );
+            _renderFrame();
 
             if ( _postprocessing ) {
                 _postprocessing();
@@ -1541,23 +1597,34 @@ namespace fheroes2
             Copy( backup, 0, 0, *this, backup.x(), backup.y(), backup.width(), backup.height() );
         }
         else {
-            _renderFrame( temp );
+            _renderFrame();
 
             if ( _postprocessing ) {
                 _postprocessing();
             }
         }
 
-        _prevRoi = temp;
+        // The area of this frame is rendered again on the next frame. The current region is cleared at the beginning of the next frame.
+        std::swap( _prevRegion, _currentRegion );
     }
 
     void Display::updateNextRenderRoi( const Rect & roi )
     {
-        _prevRoi = getBoundaryRect( _prevRoi, roi );
-        getActiveArea( _prevRoi, width(), height() );
+        _prevRegion.add( roi );
+    }
+
+    void Display::_renderFrame()
+    {
+        const Time renderTime;
+
+        _renderImage();
+
+        // An exponential moving average keeps the value stable enough to be readable on screen.
+        const double renderTimeMs = renderTime.getS() * 1000;
+        _averageRenderTimeMs = ( _averageRenderTimeMs > 0 ) ? _averageRenderTimeMs * 0.9 + renderTimeMs * 0.1 : renderTimeMs;
     }
 
-    void Display::_renderFrame( const Rect & roi ) const
+    void Display::_renderImage()
     {
         bool updateImage = true;
         if ( _preprocessing ) {
@@ -1568,7 +1635,7 @@ namespace fheroes2
                 updateImage = ( _renderSurface == nullptr );
                 if ( updateImage ) {
                     // Pre-processing step is applied to the whole image so we forcefully render the full frame.
-                    _engine->render( *this, { 0, 0, width(), height() } );
+                    _engine->render( *this, { { 0, 0, width(), height() } } );
                     return;
                 }
             }
@@ -1576,7 +1643,8 @@ namespace fheroes2
 
         if ( updateImage ) {
             // Make sure that we update the previously rendered area to avoid any ghost effect artefacts.
-            _engine->render( *this, getBoundaryRect( roi, _prevRoi ) );
+            _prevRegion.add( _currentRegion );
+            _engine->render( *this, _prevRegion.getRects() );
         }
     }
 
@@ -1596,7 +1664,8 @@ namespace fheroes2
         _cursor.reset();
         clear();
 
-        _prevRoi = {};
+        _prevRegion.resize( 0, 0 );
+        _currentRegion.resize( 0, 0 );
     }
 
     void Display::changePalette( const uint8_t * palette, const bool forceDefaultPaletteUpdate ) const
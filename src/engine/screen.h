@@ -27,6 +27,7 @@
 #include <tuple>
 #include <vector>
 
+#include "dirty_region.h"
 #include "image.h"
 #include "math_base.h"
 
@@ -157,7 +158,8 @@ namespace fheroes2
             // Do nothing.
         }
 
-        virtual void render( const Display & /*unused*/, const Rect & /*unused*/ )
+        // Render the given non-overlapping areas of the display.
+        virtual void render( const Display & /*unused*/, const std::vector<Rect> & /*unused*/ )
         {
             // Do nothing.
         }
@@ -199,6 +201,10 @@ namespace fheroes2
 
         static Display & instance();
 
+        // Make the display render nothing and ignore the system cursor. It is used to run the game without any window,
+        // for example, for automated playtests. This method must be called before the very first call of instance().
+        static void enableHeadlessMode();
+
         ~Display() override = default;
 
         // Render an entire frame on screen.
@@ -258,6 +264,12 @@ namespace fheroes2
             return _screenSize;
         }
 
+        // Returns the average time in milliseconds spent to pass a frame to the render engine (including pixel format conversion).
+        double getAverageRenderTime() const
+        {
+            return _averageRenderTimeMs;
+        }
+
         friend BaseRenderEngine & engine();
         friend Cursor & cursor();
 
@@ -269,11 +281,16 @@ namespace fheroes2
 
         uint8_t * _renderSurface{ nullptr };
 
-        // Previous area drawn on the screen.
-        Rect _prevRoi;
+        // Area drawn on the screen during the previous frame plus areas requested by updateNextRenderRoi() method.
+        DirtyRegion _prevRegion;
+
+        // Area being drawn on the screen during the current frame.
+        DirtyRegion _currentRegion;
 
         Size _screenSize;
 
+        double _averageRenderTimeMs{ 0 };
+
         // Only for cases of direct drawing on rendered 8-bit image.
         void linkRenderSurface( uint8_t * surface )
         {
@@ -282,7 +299,9 @@ namespace fheroes2
 
         Display();
 
-        void _renderFrame( const Rect & roi ) const; // prepare and render a frame
+        void _renderFrame(); // prepare and render a frame and measure the render time
+
+        void _renderImage();
     };
 
     class Cursor
@@ -1,6 +1,6 @@
 /***************************************************************************
  *   fheroes2: https://github.com/ihhub/fheroes2                           *
- *   Copyright (C) 2019 - 2025                                             *
+ *   Copyright (C) 2019 - 2026                                             *
  *                                                                         *
  *   Free Heroes2 Engine: http://sourceforge.net/projects/fheroes2         *
  *   Copyright (C) 2012 by Andrey Afletdinov <fheroes2@gmail.com>          *
@@ -366,6 +366,16 @@ ROStreamBuf::ROStreamBuf( const std::vector<uint8_t> & buf )
     setBigendian( IS_BIGENDIAN );
 }
 
+ROStreamBuf::ROStreamBuf( const uint8_t * data, const size_t size )
+{
+    _itbeg = data;
+    _itend = _itbeg + size;
+    _itget = _itbeg;
+    _itput = _itend;
+
+    setBigendian( IS_BIGENDIAN );
+}
+
 ROStreamBuf::ROStreamBuf( std::vector<uint8_t> && buf )
     : _buf( std::move( buf ) )
 {
@@ -1,6 +1,6 @@
 /***************************************************************************
  *   fheroes2: https://github.com/ihhub/fheroes2                           *
- *   Copyright (C) 2019 - 2025                                             *
+ *   Copyright (C) 2019 - 2026                                             *
  *                                                                         *
  *   Free Heroes2 Engine: http://sourceforge.net/projects/fheroes2         *
  *   Copyright (C) 2012 by Andrey Afletdinov <fheroes2@gmail.com>          *
@@ -597,6 +597,8 @@ class ROStreamBuf final : public StreamBufTmpl<const uint8_t>
 public:
     // Creates a non-owning stream on top of an external buffer ("view mode")
     explicit ROStreamBuf( const std::vector<uint8_t> & buf );
+    // Creates a non-owning stream on top of an external memory area ("view mode")
+    ROStreamBuf( const uint8_t * data, const size_t size );
     // Takes ownership of the given buffer (through the move operation) and creates a stream on top of it
     explicit ROStreamBuf( std::vector<uint8_t> && buf );
 
@@ -1,6 +1,6 @@
 /***************************************************************************
  *   fheroes2: https://github.com/ihhub/fheroes2                           *
- *   Copyright (C) 2019 - 2025                                             *
+ *   Copyright (C) 2019 - 2026                                             *
  *                                                                         *
  *   Free Heroes2 Engine: http://sourceforge.net/projects/fheroes2         *
  *   Copyright (C) 2013 by Andrey Afletdinov <fheroes2@gmail.com>          *
@@ -23,6 +23,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <ctime>
 #include <filesystem>
 #include <string>
@@ -45,6 +46,10 @@ namespace System
     bool MakeDirectory( const std::string_view path );
     bool Unlink( const std::string_view path );
 
+    // Renames the file, replacing the file with the new name if it already exists. Within the same file system, the replacement
+    // is atomic on all supported platforms, so the file with the new name is never observed in a partially written state.
+    bool renameFile( const std::string_view oldPath, const std::string_view newPath );
+
     std::string concatPath( const std::string_view left, const std::string_view right );
 
     void appendOSSpecificDirectories( std::vector<std::string> & directories );
@@ -64,6 +69,10 @@ namespace System
     bool IsFile( const std::string_view path );
     bool IsDirectory( const std::string_view path );
 
+    // Retrieves the size of the file and the time of its last modification. The time is measured in platform-specific units
+    // and it can only be compared with other values returned by this function. Returns false if the information is not available.
+    bool getFileSizeAndModificationTime( const std::string_view path, uint64_t & size, int64_t & modificationTime );
+
     bool GetCaseInsensitivePath( const std::string_view path, std::string & correctedPath );
 
     // Resolves the wildcard pattern 'glob' and appends matching paths to 'fileNames'. Supported wildcards are '?' and '*'.
@@ -1,6 +1,6 @@
 /***************************************************************************
  *   fheroes2: https://github.com/ihhub/fheroes2                           *
- *   Copyright (C) 2022 - 2025                                             *
+ *   Copyright (C) 2022 - 2026                                             *
  *                                                                         *
  *   This program is free software; you can redistribute it and/or modify  *
  *   it under the terms of the GNU General Public License as published by  *
@@ -20,7 +20,9 @@
 
 #include "thread.h"
 
+#include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <memory>
 
 #if defined( __EMSCRIPTEN__ ) && !defined( __EMSCRIPTEN_PTHREADS__ )
@@ -50,6 +52,15 @@ namespace
 }
 #endif
 
+namespace
+{
+    // The maximum number of worker threads of the shared pool.
+    const size_t maxSharedPoolWorkerCount{ 16 };
+
+    // Set for the threads which execute tasks of a pool: worker threads and the calling thread of a pool without workers.
+    thread_local bool isPoolTaskThread{ false };
+}
+
 namespace MultiThreading
 {
     void AsyncManager::createWorker()
@@ -150,4 +161,130 @@ namespace MultiThreading
             manager->executeTask();
         }
     }
+
+    WorkerPool::WorkerPool( const size_t workerCount )
+    {
+#if defined( __EMSCRIPTEN__ ) && !defined( __EMSCRIPTEN_PTHREADS__ )
+        (void)workerCount;
+#else
+        _workers.reserve( workerCount );
+
+        for ( size_t workerId = 0; workerId < workerCount; ++workerId ) {
+            _workers.emplace_back( &WorkerPool::_workerThread, this, workerId );
+        }
+#endif
+    }
+
+    WorkerPool::~WorkerPool()
+    {
+        {
+            const std::scoped_lock<std::mutex> lock( _mutex );
+
+            _exitFlag = true;
+        }
+
+        _workerNotification.notify_all();
+
+        for ( std::thread & worker : _workers ) {
+            worker.join();
+        }
+    }
+
+    void WorkerPool::execute( const size_t taskCount, const std::function<void( const size_t taskId, const size_t workerId )> & task,
+                              const std::function<void()> & waitCallback )
+    {
+        // A task executed by a pool should not use any pool, otherwise it could wait for itself.
+        assert( !isPoolTaskThread );
+
+        const std::scoped_lock<std::mutex> executionLock( _executionMutex );
+
+        if ( _workers.empty() ) {
+            isPoolTaskThread = true;
+
+            for ( size_t taskId = 0; taskId < taskCount; ++taskId ) {
+                task( taskId, 0 );
+
+                if ( waitCallback ) {
+                    waitCallback();
+                }
+            }
+
+            isPoolTaskThread = false;
+
+            return;
+        }
+
+        {
+            const std::scoped_lock<std::mutex> lock( _mutex );
+
+            assert( _task == nullptr );
+
+            _task = &task;
+            _taskCount = taskCount;
+            _nextTaskId = 0;
+            _completedTaskCount = 0;
+        }
+
+        _workerNotification.notify_all();
+
+        std::unique_lock<std::mutex> lock( _mutex );
+
+        while ( !_masterNotification.wait_for( lock, std::chrono::milliseconds( 10 ), [this] { return _completedTaskCount == _taskCount; } ) ) {
+            if ( !waitCallback ) {
+                continue;
+            }
+
+            lock.unlock();
+
+            waitCallback();
+
+            lock.lock();
+        }
+
+        _task = nullptr;
+        _taskCount = 0;
+        _nextTaskId = 0;
+    }
+
+    bool WorkerPool::isTaskThread()
+    {
+        return isPoolTaskThread;
+    }
+
+    void WorkerPool::_workerThread( const size_t workerId )
+    {
+        isPoolTaskThread = true;
+
+        std::unique_lock<std::mutex> lock( _mutex );
+
+        while ( true ) {
+            _workerNotification.wait( lock, [this] { return _exitFlag || _nextTaskId < _taskCount; } );
+
+            if ( _exitFlag ) {
+                break;
+            }
+
+            const size_t taskId = _nextTaskId++;
+            const std::function<void( const size_t, const size_t )> & task = *_task;
+
+            lock.unlock();
+
+            task( taskId, workerId );
+
+            lock.lock();
+
+            ++_completedTaskCount;
+
+            if ( _completedTaskCount == _taskCount ) {
+                _masterNotification.notify_one();
+            }
+        }
+    }
+
+    WorkerPool & getSharedWorkerPool()
+    {
+        static WorkerPool pool( std::min<size_t>( std::thread::hardware_concurrency(), maxSharedPoolWorkerCount ) );
+
+        return pool;
+    }
 }
@@ -1,6 +1,6 @@
 /***************************************************************************
  *   fheroes2: https://github.com/ihhub/fheroes2                           *
- *   Copyright (C) 2022 - 2025                                             *
+ *   Copyright (C) 2022 - 2026                                             *
  *                                                                         *
  *   This program is free software; you can redistribute it and/or modify  *
  *   it under the terms of the GNU General Public License as published by  *
@@ -22,9 +22,12 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <cstddef>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <thread>
+#include <vector>
 
 namespace MultiThreading
 {
@@ -70,4 +73,60 @@ namespace MultiThreading
 
         static void _workerThread( AsyncManager * manager );
     };
+
+    // Executes independent tasks in parallel using a fixed number of worker threads. The creation and destruction of the pool
+    // are not designed to be performed concurrently. Concurrent calls of execute() are performed one after another.
+    class WorkerPool
+    {
+    public:
+        // Creates the given number of worker threads. If the number is zero or threads are not supported on the current
+        // platform, then all tasks are executed by the calling thread.
+        explicit WorkerPool( const size_t workerCount );
+        WorkerPool( const WorkerPool & ) = delete;
+
+        ~WorkerPool();
+
+        WorkerPool & operator=( const WorkerPool & ) = delete;
+
+        // Returns the number of distinct worker IDs that can be passed to tasks. It is never zero.
+        size_t getWorkerCount() const
+        {
+            return _workers.empty() ? 1 : _workers.size();
+        }
+
+        // Executes task( taskId, workerId ) for every taskId in the range [0, taskCount) and waits for all of them to complete.
+        // Every worker executes its tasks one after another, so the data associated with the worker ID can be used by a task
+        // without synchronization. While waiting, the calling thread periodically calls waitCallback (if set), for example,
+        // to process the event queue.
+        void execute( const size_t taskCount, const std::function<void( const size_t taskId, const size_t workerId )> & task,
+                      const std::function<void()> & waitCallback );
+
+        // Returns true if the calling thread is executing a task of any pool. Such a task should do all its work on the current
+        // thread instead of passing it to another pool.
+        static bool isTaskThread();
+
+    private:
+        std::vector<std::thread> _workers;
+
+        // Serializes the calls of execute().
+        std::mutex _executionMutex;
+        std::mutex _mutex;
+
+        std::condition_variable _masterNotification;
+        std::condition_variable _workerNotification;
+
+        const std::function<void( const size_t, const size_t )> * _task{ nullptr };
+
+        size_t _taskCount{ 0 };
+        size_t _nextTaskId{ 0 };
+        size_t _completedTaskCount{ 0 };
+
+        bool _exitFlag{ false };
+
+        void _workerThread( const size_t workerId );
+    };
+
+    // Returns the pool shared by all parallel computations of the game. It is created on first use and has one worker per
+    // hardware thread (up to a reasonable limit). Tasks executed by this pool must not use it.
+    WorkerPool & getSharedWorkerPool();
 }
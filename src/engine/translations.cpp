@@ -35,11 +35,10 @@
 #include <ostream>
 #include <string>
 #include <string_view>
-#include <type_traits>
-#include <unordered_map>
 #include <vector>
 
 #include "logging.h"
+#include "memory_mapped_file.h"
 #include "serialize.h"
 #include "tools.h"
 
@@ -47,25 +46,6 @@ namespace
 {
     const char contextSeparator = '|';
 
-    constexpr std::array<uint32_t, 256> getCRC32Table()
-    {
-        std::array<uint32_t, 256> table{ 0 };
-
-        for ( uint32_t i = 0; i < 256; ++i ) {
-            uint32_t crc = i;
-
-            for ( int bit = 0; bit < 8; ++bit ) {
-                crc = ( crc & 1 ) ? ( ( crc >> 1 ) ^ 0xEDB88320 ) : ( crc >> 1 );
-            }
-
-            table[i] = crc;
-        }
-
-        return table;
-    }
-
-    const std::array<uint32_t, 256> crc32Table = getCRC32Table();
-
     // Character lookup table for custom tolower
     // Compatible with ASCII, custom French encoding, CP1250 and CP1251
     const std::array<unsigned char, 256> tolowerLUT
@@ -297,17 +277,6 @@ namespace
         return iter->second;
     }
 
-    uint32_t crc32b( const std::string_view str )
-    {
-        uint32_t crc = 0xFFFFFFFF;
-
-        for ( const char ch : str ) {
-            crc = ( crc >> 8 ) ^ crc32Table[( crc ^ static_cast<uint32_t>( ch ) ) & 0xFF];
-        }
-
-        return ~crc;
-    }
-
     bool getCharsetFromHeader( const std::string & hdr, std::string & charset )
     {
         constexpr std::string_view hdrEntry{ "Content-Type:" };
@@ -341,50 +310,114 @@ namespace
     class MOFile final
     {
     public:
+        // All strings point directly to the MO file data which is kept in memory as long as this object exists.
+        struct Entry final
+        {
+            std::string_view original;
+
+            // Plural forms of the translation separated by null characters. The last plural form is null-terminated as well.
+            const char * translation{ nullptr };
+            uint32_t translationLength{ 0 };
+        };
+
         MOFile() = default;
+        MOFile( const MOFile & ) = delete;
 
-        const char * ngettext( const char * str, const size_t plural ) const
+        ~MOFile() = default;
+
+        MOFile & operator=( const MOFile & ) = delete;
+
+        // Returns nullptr if there is no translation for the given string.
+        const Entry * find( const char * str ) const
         {
             if ( !_isValid ) {
                 assert( 0 );
 
-                return stripContext( str );
+                return nullptr;
             }
 
-            const auto iter = std::as_const( _translations ).find( crc32b( str ) );
-            if ( iter == _translations.cend() ) {
-                return stripContext( str );
-            }
+            const std::string_view original{ str };
 
-            const auto & [dummy, pluralFormTranslations] = *iter;
-            if ( plural >= pluralFormTranslations.size() ) {
-                return stripContext( str );
+            const auto iter = std::lower_bound( _entries.begin(), _entries.end(), original,
+                                                []( const Entry & entry, const std::string_view value ) { return entry.original < value; } );
+            if ( iter == _entries.end() || iter->original != original ) {
+                return nullptr;
             }
 
-            const std::string & translatedStr = pluralFormTranslations[plural];
-            if ( translatedStr.empty() ) {
-                return stripContext( str );
+            return &( *iter );
+        }
+
+        bool load( const std::string_view langName, const std::string & fileName )
+        {
+            assert( !_isValid && _entries.empty() );
+
+            if ( _load( langName, fileName ) ) {
+                return true;
             }
 
-            return translatedStr.c_str();
+            // Invalid translations are kept in the cache, so release the file data right away.
+            _entries = {};
+            _fileData = {};
+            _mappedFile.close();
+
+            return false;
         }
 
-        bool load( const std::string_view langName, const std::string & fileName )
+        LocaleType getLocale() const
+        {
+            return _locale;
+        }
+
+        bool isEncoding( const std::string_view encoding ) const
         {
-            *this = {};
+            return ( _encoding == encoding );
+        }
 
-            StreamFile sf;
-            if ( !sf.open( fileName, "rb" ) ) {
-                return false;
+        bool isValid() const
+        {
+            return _isValid;
+        }
+
+    private:
+        MemoryMappedFile _mappedFile;
+
+        // Contents of the MO file if it cannot be memory mapped.
+        std::vector<uint8_t> _fileData;
+
+        // Sorted by the original strings.
+        std::vector<Entry> _entries;
+
+        LocaleType _locale{ LocaleType::LOCALE_EN };
+        std::string _encoding;
+        bool _isValid{ false };
+
+        bool _load( const std::string_view langName, const std::string & fileName )
+        {
+            // The MO file is memory mapped if possible, so the translations are not copied and unused pages are not even read.
+            const uint8_t * fileData = nullptr;
+            size_t fileSize = 0;
+
+            if ( _mappedFile.open( fileName ) ) {
+                fileData = _mappedFile.data();
+                fileSize = _mappedFile.size();
             }
+            else {
+                StreamFile sf;
+                if ( !sf.open( fileName, "rb" ) ) {
+                    return false;
+                }
 
-            ROStreamBuf sb = sf.getStreamBuf();
-            if ( sf.fail() ) {
-                ERROR_LOG( "I/O error when reading " << fileName )
-                return false;
+                _fileData = sf.getRaw( 0 );
+                if ( sf.fail() ) {
+                    ERROR_LOG( "I/O error when reading " << fileName )
+                    return false;
+                }
+
+                fileData = _fileData.data();
+                fileSize = _fileData.size();
             }
 
-            sf.close();
+            ROStreamBuf sb( fileData, fileSize );
 
             {
                 const uint32_t magicNumber = sb.getLE32();
@@ -482,26 +515,42 @@ namespace
 
                 sb.seek( tranStrOff );
 
-                const auto [tranBufPtr, tranBufLen] = sb.getRawView( tranStrLen );
+                // Translations are returned to the caller as C strings, so the terminating null character must be present as well.
+                const size_t tranBufSize = static_cast<size_t>( tranStrLen ) + 1;
+
+                const auto [tranBufPtr, tranBufLen] = sb.getRawView( tranBufSize );
                 if ( sb.fail() ) {
                     ERROR_LOG( "I/O error when parsing " << fileName )
                     return false;
                 }
 
-                static_assert( std::is_same_v<std::remove_const_t<std::remove_reference_t<decltype( *tranBufPtr )>>, unsigned char> );
-
-                if ( const auto [dummy, inserted]
-                     = _translations.try_emplace( crc32b( origStr ), StringSplit( { reinterpret_cast<const char *>( tranBufPtr ), tranBufLen }, '\0' ) );
-                     !inserted ) {
-                    ERROR_LOG( "Hash collision detected for string \"" << origStr << "\"" )
+                if ( tranBufLen != tranBufSize || tranBufPtr[tranStrLen] != 0 ) {
+                    ERROR_LOG( "Translation of string \"" << origStr << "\" is not null-terminated in " << fileName )
+                    return false;
                 }
+
+                _entries.push_back( { origStr, reinterpret_cast<const char *>( tranBufPtr ), tranStrLen } );
             }
 
-            if ( _translations.empty() ) {
+            if ( _entries.empty() ) {
                 ERROR_LOG( "There are no translated strings in " << fileName )
                 return false;
             }
 
+            // Original strings in MO files are sorted in lexicographical order so this is only a safety measure for non-standard files.
+            const auto isLess = []( const Entry & left, const Entry & right ) { return left.original < right.original; };
+            if ( !std::is_sorted( _entries.begin(), _entries.end(), isLess ) ) {
+                std::stable_sort( _entries.begin(), _entries.end(), isLess );
+            }
+
+            if ( const auto iter = std::adjacent_find( _entries.begin(), _entries.end(),
+                                                       []( const Entry & left, const Entry & right ) { return left.original == right.original; } );
+                 iter != _entries.end() ) {
+                ERROR_LOG( "Duplicate original string \"" << iter->original << "\" found in " << fileName )
+            }
+
+            _entries.shrink_to_fit();
+
             _locale = langToLocale( langName );
 
             // The empty line in the MO file goes first (since the original lines in it are sorted in increasing lexicographical order),
@@ -538,31 +587,144 @@ namespace
 
             return true;
         }
+    };
 
-        LocaleType getLocale() const
-        {
-            return _locale;
+    // Cache of lookups of the string literals indexed by the literal address.
+    struct LiteralLookup final
+    {
+        const char * str{ nullptr };
+        const MOFile::Entry * entry{ nullptr };
+        uint32_t generation{ 0 };
+    };
+
+    MOFile * current = nullptr;
+    std::map<std::string, MOFile, std::less<>> cache;
+
+    // It is increased every time the current language changes, which invalidates all cached literal lookups.
+    uint32_t languageGeneration = 1;
+
+    // Every thread has its own cache so there is no need for any synchronization.
+    thread_local std::array<LiteralLookup, 1024> literalLookupCache;
+
+    void setCurrent( MOFile * file )
+    {
+        if ( current != file ) {
+            current = file;
+            ++languageGeneration;
         }
+    }
 
-        bool isEncoding( const std::string_view encoding ) const
-        {
-            return ( _encoding == encoding );
+    const MOFile::Entry * findCached( const char * str )
+    {
+        assert( current != nullptr );
+
+        const uintptr_t address = reinterpret_cast<uintptr_t>( str );
+        LiteralLookup & lookup = literalLookupCache[( address ^ ( address >> 10 ) ) % literalLookupCache.size()];
+
+        if ( lookup.str != str || lookup.generation != languageGeneration ) {
+            lookup.str = str;
+            lookup.entry = current->find( str );
+            lookup.generation = languageGeneration;
         }
 
-        bool isValid() const
-        {
-            return _isValid;
+        return lookup.entry;
+    }
+
+    const char * getPluralForm( const MOFile::Entry * entry, const char * str, const size_t plural )
+    {
+        if ( entry == nullptr ) {
+            return stripContext( str );
         }
 
-    private:
-        LocaleType _locale{ LocaleType::LOCALE_EN };
-        std::unordered_map<uint32_t, std::vector<std::string>> _translations;
-        std::string _encoding;
-        bool _isValid{ false };
-    };
+        const char * form = entry->translation;
+        const char * end = entry->translation + entry->translationLength;
 
-    MOFile * current = nullptr;
-    std::map<std::string, MOFile, std::less<>> cache;
+        for ( size_t i = 0; i < plural; ++i ) {
+            form = static_cast<const char *>( std::memchr( form, '\0', static_cast<size_t>( end - form ) ) );
+            if ( form == nullptr ) {
+                return stripContext( str );
+            }
+
+            ++form;
+        }
+
+        if ( *form == '\0' ) {
+            return stripContext( str );
+        }
+
+        return form;
+    }
+
+    // Returns false if plural forms are not supported for the given locale.
+    bool getPluralFormIndex( const LocaleType locale, const size_t n, size_t & plural )
+    {
+        switch ( locale ) {
+        case LocaleType::LOCALE_AF:
+        case LocaleType::LOCALE_BG:
+        case LocaleType::LOCALE_DA:
+        case LocaleType::LOCALE_DE:
+        case LocaleType::LOCALE_EO:
+        case LocaleType::LOCALE_ES:
+        case LocaleType::LOCALE_ET:
+        case LocaleType::LOCALE_EU:
+        case LocaleType::LOCALE_FI:
+        case LocaleType::LOCALE_GL:
+        case LocaleType::LOCALE_HE:
+        case LocaleType::LOCALE_HU:
+        case LocaleType::LOCALE_ID:
+        case LocaleType::LOCALE_IT:
+        case LocaleType::LOCALE_LA:
+        case LocaleType::LOCALE_NB:
+        case LocaleType::LOCALE_NL:
+        case LocaleType::LOCALE_SV:
+        case LocaleType::LOCALE_TR:
+            plural = ( n != 1 );
+            return true;
+        case LocaleType::LOCALE_EL:
+        case LocaleType::LOCALE_FR:
+        case LocaleType::LOCALE_PT:
+            plural = ( n > 1 );
+            return true;
+        case LocaleType::LOCALE_AR:
+            plural = ( n == 0 ? 0 : n == 1 ? 1 : n == 2 ? 2 : n % 100 >= 3 && n % 100 <= 10 ? 3 : n % 100 >= 11 && n % 100 <= 99 ? 4 : 5 );
+            return true;
+        case LocaleType::LOCALE_RO:
+            plural = ( n == 1 ? 0 : n == 0 || ( n != 1 && n % 100 >= 1 && n % 100 <= 19 ) ? 1 : 2 );
+            return true;
+        case LocaleType::LOCALE_SL:
+            plural = ( n % 100 == 1 ? 0 : n % 100 == 2 ? 1 : n % 100 == 3 || n % 100 == 4 ? 2 : 3 );
+            return true;
+        case LocaleType::LOCALE_SR:
+            plural = ( n == 1 ? 3 : n % 10 == 1 && n % 100 != 11 ? 0 : n % 10 >= 2 && n % 10 <= 4 && ( n % 100 < 10 || n % 100 >= 20 ) ? 1 : 2 );
+            return true;
+        case LocaleType::LOCALE_CS:
+        case LocaleType::LOCALE_SK:
+            plural = ( ( n == 1 ) ? 0 : ( n >= 2 && n <= 4 ) ? 1 : 2 );
+            return true;
+        case LocaleType::LOCALE_HR:
+        case LocaleType::LOCALE_LV:
+        case LocaleType::LOCALE_RU:
+            plural = ( n % 10 == 1 && n % 100 != 11 ? 0 : n % 10 >= 2 && n % 10 <= 4 && ( n % 100 < 10 || n % 100 >= 20 ) ? 1 : 2 );
+            return true;
+        case LocaleType::LOCALE_LT:
+            plural = ( n % 10 == 1 && n % 100 != 11 ? 0 : n % 10 >= 2 && ( n % 100 < 10 || n % 100 >= 20 ) ? 1 : 2 );
+            return true;
+        case LocaleType::LOCALE_MK:
+            plural = ( n == 1 || n % 10 == 1 ? 0 : 1 );
+            return true;
+        case LocaleType::LOCALE_PL:
+            plural = ( n == 1 ? 0 : n % 10 >= 2 && n % 10 <= 4 && ( n % 100 < 10 || n % 100 >= 20 ) ? 1 : 2 );
+            return true;
+        case LocaleType::LOCALE_BE:
+        case LocaleType::LOCALE_UK:
+            plural = ( n % 10 == 1 && n % 100 != 11 ? 0 : n % 10 >= 2 && n % 10 <= 4 && ( n % 100 < 12 || n % 100 > 14 ) ? 1 : 2 );
+            return true;
+        default:
+            break;
+        }
+
+        return false;
+    }
 }
 
 std::pair<bool, bool> Translation::setLanguage( const std::string_view langName )
@@ -573,7 +735,7 @@ std::pair<bool, bool> Translation::setLanguage( const std::string_view langName
         MOFile & item = iter->second;
 
         if ( item.isValid() ) {
-            current = &item;
+            setCurrent( &item );
         }
 
         return { true, item.isValid() };
@@ -591,7 +753,7 @@ bool Translation::setLanguage( const std::string & langName, const std::string_v
 
     if ( !inserted ) {
         if ( item.isValid() ) {
-            current = &item;
+            setCurrent( &item );
         }
 
         return item.isValid();
@@ -605,91 +767,58 @@ bool Translation::setLanguage( const std::string & langName, const std::string_v
 
     assert( item.isValid() );
 
-    current = &item;
+    setCurrent( &item );
 
     return true;
 }
 
 void Translation::reset()
 {
-    current = nullptr;
+    setCurrent( nullptr );
 }
 
-const char * Translation::gettext( const std::string & str )
+const char * Translation::getTranslation( const char * str )
 {
-    return current ? current->ngettext( str.c_str(), 0 ) : stripContext( str.c_str() );
+    return current ? getPluralForm( current->find( str ), str, 0 ) : stripContext( str );
 }
 
-const char * Translation::gettext( const char * str )
+const char * Translation::getTranslation( const char * str, const char * plural, const size_t n )
 {
-    return current ? current->ngettext( str, 0 ) : stripContext( str );
+    if ( current ) {
+        if ( size_t pluralFormIndex = 0; getPluralFormIndex( current->getLocale(), n, pluralFormIndex ) ) {
+            return getPluralForm( current->find( str ), str, pluralFormIndex );
+        }
+    }
+
+    return stripContext( n == 1 ? str : plural );
 }
 
-const char * Translation::getNonTranslated( const char * str )
+const char * Translation::getCachedTranslation( const char * str )
 {
-    return stripContext( str );
+    return current ? getPluralForm( findCached( str ), str, 0 ) : stripContext( str );
 }
 
-const char * Translation::ngettext( const char * str, const char * plural, const size_t n )
+const char * Translation::getCachedTranslation( const char * str, const char * plural, const size_t n )
 {
     if ( current ) {
-        switch ( current->getLocale() ) {
-        case LocaleType::LOCALE_AF:
-        case LocaleType::LOCALE_BG:
-        case LocaleType::LOCALE_DA:
-        case LocaleType::LOCALE_DE:
-        case LocaleType::LOCALE_EO:
-        case LocaleType::LOCALE_ES:
-        case LocaleType::LOCALE_ET:
-        case LocaleType::LOCALE_EU:
-        case LocaleType::LOCALE_FI:
-        case LocaleType::LOCALE_GL:
-        case LocaleType::LOCALE_HE:
-        case LocaleType::LOCALE_HU:
-        case LocaleType::LOCALE_ID:
-        case LocaleType::LOCALE_IT:
-        case LocaleType::LOCALE_LA:
-        case LocaleType::LOCALE_NB:
-        case LocaleType::LOCALE_NL:
-        case LocaleType::LOCALE_SV:
-        case LocaleType::LOCALE_TR:
-            return current->ngettext( str, ( n != 1 ) );
-        case LocaleType::LOCALE_EL:
-        case LocaleType::LOCALE_FR:
-        case LocaleType::LOCALE_PT:
-            return current->ngettext( str, ( n > 1 ) );
-        case LocaleType::LOCALE_AR:
-            return current->ngettext( str, ( n == 0 ? 0 : n == 1 ? 1 : n == 2 ? 2 : n % 100 >= 3 && n % 100 <= 10 ? 3 : n % 100 >= 11 && n % 100 <= 99 ? 4 : 5 ) );
-        case LocaleType::LOCALE_RO:
-            return current->ngettext( str, ( n == 1 ? 0 : n == 0 || ( n != 1 && n % 100 >= 1 && n % 100 <= 19 ) ? 1 : 2 ) );
-        case LocaleType::LOCALE_SL:
-            return current->ngettext( str, ( n % 100 == 1 ? 0 : n % 100 == 2 ? 1 : n % 100 == 3 || n % 100 == 4 ? 2 : 3 ) );
-        case LocaleType::LOCALE_SR:
-            return current->ngettext( str, ( n == 1 ? 3 : n % 10 == 1 && n % 100 != 11 ? 0 : n % 10 >= 2 && n % 10 <= 4 && ( n % 100 < 10 || n % 100 >= 20 ) ? 1 : 2 ) );
-        case LocaleType::LOCALE_CS:
-        case LocaleType::LOCALE_SK:
-            return current->ngettext( str, ( ( n == 1 ) ? 0 : ( n >= 2 && n <= 4 ) ? 1 : 2 ) );
-        case LocaleType::LOCALE_HR:
-        case LocaleType::LOCALE_LV:
-        case LocaleType::LOCALE_RU:
-            return current->ngettext( str, ( n % 10 == 1 && n % 100 != 11 ? 0 : n % 10 >= 2 && n % 10 <= 4 && ( n % 100 < 10 || n % 100 >= 20 ) ? 1 : 2 ) );
-        case LocaleType::LOCALE_LT:
-            return current->ngettext( str, ( n % 10 == 1 && n % 100 != 11 ? 0 : n % 10 >= 2 && ( n % 100 < 10 || n % 100 >= 20 ) ? 1 : 2 ) );
-        case LocaleType::LOCALE_MK:
-            return current->ngettext( str, ( n == 1 || n % 10 == 1 ? 0 : 1 ) );
-        case LocaleType::LOCALE_PL:
-            return current->ngettext( str, ( n == 1 ? 0 : n % 10 >= 2 && n % 10 <= 4 && ( n % 100 < 10 || n % 100 >= 20 ) ? 1 : 2 ) );
-        case LocaleType::LOCALE_BE:
-        case LocaleType::LOCALE_UK:
-            return current->ngettext( str, ( n % 10 == 1 && n % 100 != 11 ? 0 : n % 10 >= 2 && n % 10 <= 4 && ( n % 100 < 12 || n % 100 > 14 ) ? 1 : 2 ) );
-        default:
-            break;
+        if ( size_t pluralFormIndex = 0; getPluralFormIndex( current->getLocale(), n, pluralFormIndex ) ) {
+            return getPluralForm( findCached( str ), str, pluralFormIndex );
         }
     }
 
     return stripContext( n == 1 ? str : plural );
 }
 
+const char * Translation::gettext( const std::string & str )
+{
+    return getTranslation( str.c_str() );
+}
+
+const char * Translation::getNonTranslated( const char * str )
+{
+    return stripContext( str );
+}
+
 std::string Translation::StringLower( std::string str )
 {
     if ( current ) {
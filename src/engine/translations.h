@@ -26,6 +26,7 @@
 #include <cstddef>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <utility>
 
 namespace Translation
@@ -46,9 +47,54 @@ namespace Translation
     // Resets the current language to the default language (English).
     void reset();
 
-    const char * gettext( const char * str );
+    // Do not call these functions directly, use the gettext() and ngettext() overloads below.
+    const char * getTranslation( const char * str );
+    const char * getTranslation( const char * str, const char * plural, const size_t n );
+
+    // The same as above but the result of the lookup is cached using the address of the given string until the language is
+    // changed. The given string must not change its contents during the lifetime of the program (e.g. be a string literal).
+    const char * getCachedTranslation( const char * str );
+    const char * getCachedTranslation( const char * str, const char * plural, const size_t n );
+
+    template <typename T, std::enable_if_t<std::is_same_v<T, const char *> || std::is_same_v<T, char *>, bool> = true>
+    const char * gettext( const T str )
+    {
+        return getTranslation( str );
+    }
+
+    // String literals are passed to this overload, so their translations are looked up only once per language.
+    template <size_t N>
+    const char * gettext( const char ( &str )[N] )
+    {
+        return getCachedTranslation( str );
+    }
+
+    // Modifiable char arrays can have different contents at the same address, so their translations are not cached.
+    template <size_t N>
+    const char * gettext( char ( &str )[N] )
+    {
+        return getTranslation( str );
+    }
+
     const char * gettext( const std::string & str );
-    const char * ngettext( const char * str, const char * plural, const size_t n );
+
+    template <typename T, std::enable_if_t<std::is_same_v<T, const char *> || std::is_same_v<T, char *>, bool> = true>
+    const char * ngettext( const T str, const char * plural, const size_t n )
+    {
+        return getTranslation( str, plural, n );
+    }
+
+    template <size_t N>
+    const char * ngettext( const char ( &str )[N], const char * plural, const size_t n )
+    {
+        return getCachedTranslation( str, plural, n );
+    }
+
+    template <size_t N>
+    const char * ngettext( char ( &str )[N], const char * plural, const size_t n )
+    {
+        return getTranslation( str, plural, n );
+    }
 
     // Converts the given string to lowercase in a locale aware way
     std::string StringLower( std::string str );
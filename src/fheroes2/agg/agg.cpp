@@ -50,6 +50,18 @@ std::vector<uint8_t> AGG::getDataFromAggFile( const std::string & key, const boo
     return heroes2_agg.read( key );
 }
 
+fheroes2::AGGFileData AGG::getDataViewFromAggFile( const std::string & key, const bool ignoreExpansion )
+{
+    if ( !ignoreExpansion && heroes2x_agg.isGood() ) {
+        fheroes2::AGGFileData data = heroes2x_agg.readData( key );
+        if ( !data.empty() ) {
+            return data;
+        }
+    }
+
+    return heroes2_agg.readData( key );
+}
+
 AGG::AGGInitializer::AGGInitializer()
 {
     if ( init() ) {
@@ -27,6 +27,8 @@
 #include <string>
 #include <vector>
 
+#include "agg_file.h"
+
 namespace AGG
 {
     class AGGInitializer
@@ -57,6 +59,9 @@ namespace AGG
 
     std::vector<uint8_t> getDataFromAggFile( const std::string & key, const bool ignoreExpansion );
 
+    // Unlike the function above this one does not copy the data if AGG files are mapped into memory.
+    fheroes2::AGGFileData getDataViewFromAggFile( const std::string & key, const bool ignoreExpansion );
+
     // Only for internal usage within AGG namespace.
     bool isPoLResourceFilePresent();
 }
@@ -25,6 +25,7 @@
 #include <cassert>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <initializer_list>
 #include <map>
 #include <numeric>
@@ -43,6 +44,7 @@
 #include "icn.h"
 #include "image.h"
 #include "image_tool.h"
+#include "logging.h"
 #include "math_base.h"
 #include "pal.h"
 #include "rand.h"
@@ -69,6 +71,14 @@ namespace
 
     std::map<int, std::vector<fheroes2::Sprite>> _icnVsScaledSprite;
 
+    // The time of the last request of images from every ICN and TIL. It is measured in the number of image requests.
+    std::vector<uint64_t> _icnLastUseTime( ICN::LASTICN, 0 );
+    std::array<uint64_t, TIL::LASTTIL> _tilLastUseTime{};
+    uint64_t _imageRequestCounter{ 0 };
+
+    size_t _imageCacheLimit{ 0 };
+    fheroes2::AGG::ImageCacheStatistics _imageCacheStatistics;
+
     // Some resources are language dependent. These are mostly buttons with a text of them.
     // Once a user changes a language we have to update resources. To do this we need to clear the existing images.
 
@@ -643,8 +653,8 @@ namespace
 
     void replacePOLAssetWithSW( const int id, const int assetIndex )
     {
-        const std::vector<uint8_t> & body = ::AGG::getDataFromAggFile( ICN::getIcnFileName( id ), true );
-        ROStreamBuf imageStream( body );
+        const fheroes2::AGGFileData body = ::AGG::getDataViewFromAggFile( ICN::getIcnFileName( id ), true );
+        ROStreamBuf imageStream( body.data(), body.size() );
 
         imageStream.seek( headerSize + assetIndex * 13 );
 
@@ -661,6 +671,121 @@ namespace
         _icnVsSprite[id][assetIndex] = fheroes2::decodeICNSprite( data, dataEnd, header1 );
     }
 
+    // Large ICNs which are often used only partially. Their sprites are decoded one by one when they are requested for the first time.
+    // Sprites of such ICNs must not be accessed directly through `_icnVsSprite`, only by `fheroes2::AGG::GetICN()` function,
+    // therefore these ICNs must not be modified within `processICN()` function.
+    bool isLazilyDecodedICN( const int id )
+    {
+        switch ( id ) {
+        // Battle animations of monsters.
+        case ICN::PEASANT:
+        case ICN::ARCHER:
+        case ICN::ARCHER2:
+        case ICN::PIKEMAN:
+        case ICN::PIKEMAN2:
+        case ICN::CAVALRYB:
+        case ICN::PALADIN:
+        case ICN::PALADIN2:
+        case ICN::GOBLIN:
+        case ICN::ORC:
+        case ICN::ORC2:
+        case ICN::WOLF:
+        case ICN::OGRE:
+        case ICN::OGRE2:
+        case ICN::TROLL:
+        case ICN::TROLL2:
+        case ICN::CYCLOPS:
+        case ICN::SPRITE:
+        case ICN::DWARF:
+        case ICN::DWARF2:
+        case ICN::ELF:
+        case ICN::ELF2:
+        case ICN::DRUID:
+        case ICN::DRUID2:
+        case ICN::UNICORN:
+        case ICN::CENTAUR:
+        case ICN::GARGOYLE:
+        case ICN::GRIFFIN:
+        case ICN::MINOTAUR:
+        case ICN::MINOTAU2:
+        case ICN::HYDRA:
+        case ICN::DRAGGREE:
+        case ICN::DRAGRED:
+        case ICN::DRAGBLAK:
+        case ICN::HALFLING:
+        case ICN::BOAR:
+        case ICN::ROC:
+        case ICN::MAGE1:
+        case ICN::MAGE2:
+        case ICN::TITANBLU:
+        case ICN::TITANBLA:
+        case ICN::SKELETON:
+        case ICN::ZOMBIE:
+        case ICN::ZOMBIE2:
+        case ICN::MUMMYW:
+        case ICN::MUMMY2:
+        case ICN::VAMPIRE:
+        case ICN::VAMPIRE2:
+        case ICN::LICH:
+        case ICN::LICH2:
+        case ICN::DRAGBONE:
+        case ICN::ROGUE:
+        case ICN::NOMAD:
+        case ICN::GHOST:
+        case ICN::GENIE:
+        case ICN::MEDUSA:
+        case ICN::EELEM:
+        case ICN::AELEM:
+        case ICN::FELEM:
+        case ICN::WELEM:
+            return true;
+        default:
+            break;
+        }
+
+        return false;
+    }
+
+    // Raw data of a lazily decoded ICN. It is released once all sprites of the ICN are decoded.
+    struct LazyICNData
+    {
+        // A view of the memory-mapped AGG file or a copy of the ICN data.
+        fheroes2::AGGFileData body;
+
+        std::vector<fheroes2::ICNHeader> headers;
+        std::vector<uint32_t> dataSizes;
+        std::vector<uint8_t> isDecoded;
+
+        uint32_t remainingSprites{ 0 };
+    };
+
+    std::map<int, LazyICNData> _lazyIcnData;
+
+    void decodeLazyICNSprite( const int id, const uint32_t index )
+    {
+        auto iter = _lazyIcnData.find( id );
+        if ( iter == _lazyIcnData.end() ) {
+            return;
+        }
+
+        LazyICNData & icnData = iter->second;
+        assert( index < icnData.headers.size() );
+
+        if ( icnData.isDecoded[index] != 0 ) {
+            return;
+        }
+
+        const uint8_t * data = icnData.body.data() + headerSize + icnData.headers[index].offsetData;
+        _icnVsSprite[id][index] = fheroes2::decodeICNSprite( data, data + icnData.dataSizes[index], icnData.headers[index] );
+
+        icnData.isDecoded[index] = 1;
+        --icnData.remainingSprites;
+
+        if ( icnData.remainingSprites == 0 ) {
+            _lazyIcnData.erase( iter );
+        }
+    }
+
     // This function returns true if sprites were successfully loaded from AGG file.
     // WARNING: this function must be called once - only in the beginning of `loadICN()` function.
     bool readIcnFromAgg( const int id )
@@ -668,13 +793,13 @@ namespace
         // If this assertion blows up then something wrong with your logic and you load resources more than once!
         assert( _icnVsSprite[id].empty() );
 
-        const std::vector<uint8_t> & body = ::AGG::getDataFromAggFile( ICN::getIcnFileName( id ), false );
+        fheroes2::AGGFileData body = ::AGG::getDataViewFromAggFile( ICN::getIcnFileName( id ), false );
 
         if ( body.empty() ) {
             return false;
         }
 
-        ROStreamBuf imageStream( body );
+        ROStreamBuf imageStream( body.data(), body.size() );
 
         const uint32_t count = imageStream.getLE16();
         const uint32_t blockSize = imageStream.getLE32();
@@ -682,12 +807,13 @@ namespace
             return false;
         }
 
-        _icnVsSprite[id].resize( count );
+        std::vector<fheroes2::ICNHeader> headers( count );
+        std::vector<uint32_t> dataSizes( count );
 
         for ( uint32_t i = 0; i < count; ++i ) {
             imageStream.seek( headerSize + i * 13 );
 
-            fheroes2::ICNHeader header1;
+            fheroes2::ICNHeader & header1 = headers[i];
             imageStream >> header1;
 
             // There should be enough frames for ICNs with animation. When animationFrames is equal to 32 then it is a Monochromatic image
@@ -710,10 +836,26 @@ namespace
                                                         "Make sure that you own an official version of the game." );
             }
 
-            const uint8_t * data = body.data() + headerSize + header1.offsetData;
-            const uint8_t * dataEnd = data + dataSize;
+            dataSizes[i] = dataSize;
+        }
+
+        // Sprites stay empty until they are decoded.
+        _icnVsSprite[id].resize( count );
+
+        if ( isLazilyDecodedICN( id ) ) {
+            LazyICNData & icnData = _lazyIcnData[id];
+            icnData.body = std::move( body );
+            icnData.headers = std::move( headers );
+            icnData.dataSizes = std::move( dataSizes );
+            icnData.isDecoded.assign( count, 0 );
+            icnData.remainingSprites = count;
+
+            return true;
+        }
 
-            _icnVsSprite[id][i] = fheroes2::decodeICNSprite( data, dataEnd, header1 );
+        for ( uint32_t i = 0; i < count; ++i ) {
+            const uint8_t * data = body.data() + headerSize + headers[i].offsetData;
+            _icnVsSprite[id][i] = fheroes2::decodeICNSprite( data, data + dataSizes[i], headers[i] );
         }
 
         return true;
@@ -1670,7 +1812,7 @@ namespace
         }
         case ICN::BUTTONS_NEW_GAME_MENU_GOOD: {
             // Set the size depending on whether PoL assets are present or not, in which case add 4 more for campaign buttons.
-            const bool isPoLPresent = !::AGG::getDataFromAggFile( ICN::getIcnFileName( ICN::X_TRACK1 ), false ).empty();
+            const bool isPoLPresent = !::AGG::getDataViewFromAggFile( ICN::getIcnFileName( ICN::X_TRACK1 ), false ).empty();
             if ( isPoLPresent ) {
                 _icnVsSprite[id].resize( 28 );
             }
@@ -2100,7 +2242,7 @@ namespace
     {
         switch ( id ) {
         case ICN::BUTTONS_NEW_GAME_MENU_GOOD: {
-            const bool isPoLPresent = !::AGG::getDataFromAggFile( ICN::getIcnFileName( ICN::X_TRACK1 ), false ).empty();
+            const bool isPoLPresent = !::AGG::getDataViewFromAggFile( ICN::getIcnFileName( ICN::X_TRACK1 ), false ).empty();
             if ( isPoLPresent ) {
                 _icnVsSprite[id].resize( 28 );
             }
@@ -2320,7 +2462,7 @@ namespace
     {
         switch ( id ) {
         case ICN::BUTTONS_NEW_GAME_MENU_GOOD: {
-            const bool isPoLPresent = !::AGG::getDataFromAggFile( ICN::getIcnFileName( ICN::X_TRACK1 ), false ).empty();
+            const bool isPoLPresent = !::AGG::getDataViewFromAggFile( ICN::getIcnFileName( ICN::X_TRACK1 ), false ).empty();
             if ( isPoLPresent ) {
                 _icnVsSprite[id].resize( 28 );
             }
@@ -2488,7 +2630,7 @@ namespace
                 throw std::logic_error( "The game resources are corrupted. Please use resources from a licensed version of Heroes of Might and Magic II." );
             }
 
-            const std::vector<uint8_t> & body = ::AGG::getDataFromAggFile( ICN::getIcnFileName( id ), false );
+            const fheroes2::AGGFileData body = ::AGG::getDataViewFromAggFile( ICN::getIcnFileName( id ), false );
             const uint32_t crc32 = fheroes2::calculateCRC32( body.data(), body.size() );
 
             if ( id == ICN::SMALFONT ) {
@@ -3461,7 +3603,7 @@ namespace
 
                 // Since we cannot access game settings from here we are checking an existence
                 // of one of POL resources as an indicator for this version.
-                if ( !::AGG::getDataFromAggFile( ICN::getIcnFileName( ICN::X_TRACK1 ), false ).empty() ) {
+                if ( !::AGG::getDataViewFromAggFile( ICN::getIcnFileName( ICN::X_TRACK1 ), false ).empty() ) {
                     fheroes2::Sprite editorIcon;
                     fheroes2::h2d::readImage( "main_menu_editor_icon.image", editorIcon );
 
@@ -5706,14 +5848,14 @@ namespace
         if ( tilImages.empty() ) {
             tilImages.resize( 4 ); // 4 possible sides
 
-            const std::vector<uint8_t> & data = ::AGG::getDataFromAggFile( tilFileName[id], false );
+            const fheroes2::AGGFileData data = ::AGG::getDataViewFromAggFile( tilFileName[id], false );
             if ( data.size() < headerSize ) {
                 // The important resource is absent! Make sure that you are using the correct version of the game.
                 assert( 0 );
                 return 0;
             }
 
-            ROStreamBuf buffer( data );
+            ROStreamBuf buffer( data.data(), data.size() );
 
             const size_t count = buffer.getLE16();
             const int32_t width = buffer.getLE16();
@@ -5805,6 +5947,66 @@ namespace
 
         return resizedIcn;
     }
+
+    void markICNUsage( const int id )
+    {
+        if ( _icnVsSprite[id].empty() ) {
+            ++_imageCacheStatistics.misses;
+        }
+        else {
+            ++_imageCacheStatistics.hits;
+        }
+
+        _icnLastUseTime[id] = ++_imageRequestCounter;
+    }
+
+    void markTILUsage( const int id )
+    {
+        if ( _tilVsImage[id].empty() ) {
+            ++_imageCacheStatistics.misses;
+        }
+        else {
+            ++_imageCacheStatistics.hits;
+        }
+
+        _tilLastUseTime[id] = ++_imageRequestCounter;
+    }
+
+    template <typename T>
+    size_t getImagesMemorySize( const std::vector<T> & images )
+    {
+        size_t size = 0;
+
+        for ( const fheroes2::Image & image : images ) {
+            const size_t pixelCount = static_cast<size_t>( image.width() ) * static_cast<size_t>( image.height() );
+            size += image.singleLayer() ? pixelCount : pixelCount * 2;
+        }
+
+        return size;
+    }
+
+    // Returns true if images of the ICN can be released and later loaded again in exactly the same state.
+    bool isEvictableICN( const int id )
+    {
+        if ( id >= ICN::LAST_VALID_FILE_ICN ) {
+            // Images generated by the engine might be created together with other ICNs and they might depend on the current language.
+            return false;
+        }
+
+        switch ( id ) {
+        case ICN::FONT:
+        case ICN::SMALFONT:
+            // Fonts are modified according to the current language.
+            return false;
+        case ICN::MINIMON:
+            // These images are modified while generating ICN::MINI_MONSTER_IMAGE and ICN::MINI_MONSTER_SHADOW.
+            return false;
+        default:
+            break;
+        }
+
+        return !isLanguageDependentIcnId( id );
+    }
 }
 
 namespace fheroes2::AGG
@@ -5815,10 +6017,17 @@ namespace fheroes2::AGG
             return errorImage;
         }
 
+        markICNUsage( icnId );
+
         if ( index >= GetMaximumICNIndex( icnId ) ) {
             return errorImage;
         }
 
+        if ( _icnVsSprite[icnId][index].empty() ) {
+            // The sprite might be not decoded yet.
+            decodeLazyICNSprite( icnId, index );
+        }
+
         if ( IsScalableICN( icnId ) ) {
             return GetScaledICN( icnId, index );
         }
@@ -5832,6 +6041,8 @@ namespace fheroes2::AGG
             return 0;
         }
 
+        markICNUsage( icnId );
+
         return static_cast<uint32_t>( GetMaximumICNIndex( icnId ) );
     }
 
@@ -5845,6 +6056,8 @@ namespace fheroes2::AGG
             return errorImage;
         }
 
+        markTILUsage( tilId );
+
         const size_t maxTILIndex = GetMaximumTILIndex( tilId );
         if ( index >= maxTILIndex ) {
             return errorImage;
@@ -5896,4 +6109,95 @@ namespace fheroes2::AGG
         currentCodePage = getCodePage( language );
         areOriginalResourcesInUse = loadOriginalAlphabet;
     }
+
+    void setImageCacheLimit( const size_t bytes )
+    {
+        _imageCacheLimit = bytes;
+    }
+
+    void trimImageCache()
+    {
+        if ( _imageCacheLimit == 0 ) {
+            return;
+        }
+
+        struct CacheEntry
+        {
+            uint64_t lastUseTime{ 0 };
+            size_t size{ 0 };
+            int id{ 0 };
+            bool isTIL{ false };
+        };
+
+        std::vector<CacheEntry> evictableEntries;
+        size_t usedBytes = 0;
+
+        for ( int id = ICN::UNKNOWN + 1; id < ICN::LASTICN; ++id ) {
+            if ( _icnVsSprite[id].empty() ) {
+                continue;
+            }
+
+            size_t size = getImagesMemorySize( _icnVsSprite[id] );
+
+            const auto scaledIter = _icnVsScaledSprite.find( id );
+            if ( scaledIter != _icnVsScaledSprite.end() ) {
+                size += getImagesMemorySize( scaledIter->second );
+            }
+
+            usedBytes += size;
+
+            if ( isEvictableICN( id ) ) {
+                evictableEntries.push_back( { _icnLastUseTime[id], size, id, false } );
+            }
+        }
+
+        for ( int id = 0; id < TIL::LASTTIL; ++id ) {
+            size_t size = 0;
+            for ( const std::vector<Image> & images : _tilVsImage[id] ) {
+                size += getImagesMemorySize( images );
+            }
+
+            if ( size > 0 ) {
+                usedBytes += size;
+                evictableEntries.push_back( { _tilLastUseTime[id], size, id, true } );
+            }
+        }
+
+        if ( usedBytes <= _imageCacheLimit ) {
+            return;
+        }
+
+        std::sort( evictableEntries.begin(), evictableEntries.end(),
+                   []( const CacheEntry & first, const CacheEntry & second ) { return first.lastUseTime < second.lastUseTime; } );
+
+        size_t evictedBytes = 0;
+
+        for ( const CacheEntry & entry : evictableEntries ) {
+            if ( usedBytes - evictedBytes <= _imageCacheLimit ) {
+                break;
+            }
+
+            if ( entry.isTIL ) {
+                std::vector<std::vector<Image>>().swap( _tilVsImage[entry.id] );
+            }
+            else {
+                std::vector<Sprite>().swap( _icnVsSprite[entry.id] );
+                _icnVsScaledSprite.erase( entry.id );
+                _lazyIcnData.erase( entry.id );
+            }
+
+            evictedBytes += entry.size;
+        }
+
+        _imageCacheStatistics.evictedBytes += evictedBytes;
+
+        DEBUG_LOG( DBG_ENGINE, DBG_INFO,
+                   "Released " << evictedBytes << " bytes of images, " << usedBytes - evictedBytes << " bytes remain in use. Cache hits: " << _imageCacheStatistics.hits
+                               << ", misses: " << _imageCacheStatistics.misses )
+    }
+
+    ImageCacheStatistics getImageCacheStatistics()
+    {
+        return _imageCacheStatistics;
+    }
 }
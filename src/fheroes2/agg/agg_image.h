@@ -1,6 +1,6 @@
 /***************************************************************************
  *   fheroes2: https://github.com/ihhub/fheroes2                           *
- *   Copyright (C) 2021 - 2025                                             *
+ *   Copyright (C) 2021 - 2026                                             *
  *                                                                         *
  *   This program is free software; you can redistribute it and/or modify  *
  *   it under the terms of the GNU General Public License as published by  *
@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 
 namespace fheroes2
@@ -31,6 +32,17 @@ namespace fheroes2
 
     namespace AGG
     {
+        struct ImageCacheStatistics
+        {
+            // The number of requests for images which were already loaded.
+            uint64_t hits{ 0 };
+
+            // The number of requests which required to load images.
+            uint64_t misses{ 0 };
+
+            uint64_t evictedBytes{ 0 };
+        };
+
         const Sprite & GetICN( int icnId, uint32_t index );
         uint32_t GetICNCount( int icnId );
 
@@ -39,5 +51,15 @@ namespace fheroes2
 
         // This function must be called only at the time of setting up a new language.
         void updateLanguageDependentResources( const SupportedLanguage language, const bool loadOriginalAlphabet );
+
+        // Sets the maximum amount of memory in bytes used by loaded images. 0 means no limit.
+        void setImageCacheLimit( const size_t bytes );
+
+        // Releases the least recently used images until the memory used by images fits into the cache limit.
+        // All references to images returned by GetICN() and GetTIL() become invalid after this call,
+        // therefore it must be called only when no such references are being held, for example, between game modes.
+        void trimImageCache();
+
+        ImageCacheStatistics getImageCacheStatistics();
     }
 }
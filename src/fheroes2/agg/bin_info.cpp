@@ -1,6 +1,6 @@
 /***************************************************************************
  *   fheroes2: https://github.com/ihhub/fheroes2                           *
- *   Copyright (C) 2020 - 2025                                             *
+ *   Copyright (C) 2020 - 2026                                             *
  *                                                                         *
  *   This program is free software; you can redistribute it and/or modify  *
  *   it under the terms of the GNU General Public License as published by  *
@@ -24,6 +24,7 @@
 #include <cstdlib>
 #include <initializer_list>
 #include <map>
+#include <mutex>
 #include <ostream>
 #include <string>
 #include <utility>
@@ -53,6 +54,9 @@ namespace
     public:
         Bin_Info::MonsterAnimInfo getAnimInfo( const int monsterID )
         {
+            // Battle units can be created by several threads at the same time.
+            const std::scoped_lock<std::mutex> lock( _mutex );
+
             auto mapIterator = _animMap.find( monsterID );
             if ( mapIterator != _animMap.end() ) {
                 return mapIterator->second;
@@ -70,6 +74,8 @@ namespace
 
     private:
         std::map<int, Bin_Info::MonsterAnimInfo> _animMap;
+
+        std::mutex _mutex;
     };
 
     MonsterAnimCache _infoCache;
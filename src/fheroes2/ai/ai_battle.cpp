@@ -56,10 +56,8 @@
 #include "game_static.h"
 #include "heroes.h"
 #include "heroes_base.h"
-#include "kingdom.h"
 #include "logging.h"
 #include "monster_info.h"
-#include "resource.h"
 #include "settings.h"
 #include "skill.h"
 #include "speed.h"
@@ -602,12 +600,6 @@ namespace
     }
 }
 
-AI::BattlePlanner & AI::BattlePlanner::Get()
-{
-    static BattlePlanner ai;
-    return ai;
-}
-
 void AI::BattlePlanner::battleBegins()
 {
     _currentTurnNumber = 0;
@@ -700,8 +692,8 @@ Battle::Actions AI::BattlePlanner::planUnitTurn( Battle::Arena & arena, const Ba
     DEBUG_LOG( DBG_BATTLE, DBG_INFO, currentUnit.GetName() << " begin the turn, color: " << Color::String( _myColor ) )
 
     // Step 2. Check retreat/surrender condition
-    const Heroes * actualHero = dynamic_cast<const Heroes *>( _commander );
-    if ( actualHero ) {
+    // Commanders of simulated battles are not heroes themselves, so everything required for the decision is obtained through the commander interface
+    if ( _commander != nullptr && _commander->isHeroes() ) {
         enum class Outcome
         {
             ContinueBattle,
@@ -709,13 +701,13 @@ Battle::Actions AI::BattlePlanner::planUnitTurn( Battle::Arena & arena, const Ba
             Surrender
         };
 
-        const Outcome outcome = [this, &arena, actualHero]() {
+        const Outcome outcome = [this, &arena]() {
             if ( !_considerRetreat ) {
                 return Outcome::ContinueBattle;
             }
 
             // Human-controlled heroes should not retreat or surrender during auto/quick combat
-            if ( actualHero->isControlHuman() ) {
+            if ( _commander->isControlHuman() ) {
                 return Outcome::ContinueBattle;
             }
 
@@ -726,8 +718,8 @@ Battle::Actions AI::BattlePlanner::planUnitTurn( Battle::Arena & arena, const Ba
                 return Outcome::ContinueBattle;
             }
 
-            const bool hasValuableArtifacts = [actualHero]() {
-                const BagArtifacts & artifactsBag = actualHero->GetBagArtifacts();
+            const bool hasValuableArtifacts = [this]() {
+                const BagArtifacts & artifactsBag = _commander->GetBagArtifacts();
 
                 return std::any_of( artifactsBag.begin(), artifactsBag.end(), []( const Artifact & art ) {
                     const fheroes2::ArtifactData & artifactData = fheroes2::getArtifactData( art.GetID() );
@@ -737,43 +729,15 @@ Battle::Actions AI::BattlePlanner::planUnitTurn( Battle::Arena & arena, const Ba
                 } );
             }();
 
-            const Kingdom & kingdom = actualHero->GetKingdom();
-
-            const bool isAbleToSurrender = [this, &arena, &kingdom]() {
+            const bool isAbleToSurrender = [this, &arena]() {
                 if ( !arena.CanSurrenderOpponent( _myColor ) ) {
                     return false;
                 }
 
-                return kingdom.AllowPayment( { Resource::GOLD, arena.getForce( _myColor ).GetSurrenderCost() } );
+                return _commander->isAbleToPaySurrenderCost( arena.getForce( _myColor ).GetSurrenderCost() );
             }();
 
-            const bool isPossibleToReHire = [actualHero, &kingdom]() {
-                // If the hero is not the last in his kingdom, then we will assume that there is a possibility of re-hiring - even if there are no castles in the
-                // kingdom, one of the remaining heroes can capture an enemy castle
-                const VecHeroes & heroes = kingdom.GetHeroes();
-                if ( heroes.size() > 1 ) {
-                    return true;
-                }
-
-                assert( heroes.size() == 1 && heroes.at( 0 ) == actualHero );
-
-                // Otherwise, if this hero is the last one, and there are no castles in the kingdom, then it will be impossible to re-hire this hero
-                const VecCastles & castles = kingdom.GetCastles();
-                if ( castles.empty() ) {
-                    return false;
-                }
-
-                // Otherwise, if this hero is defending the last castle, then it will be impossible to re-hire this hero
-                const Castle * castle = actualHero->inCastle();
-                if ( castle && castles.size() == 1 ) {
-                    assert( castles.at( 0 ) == castle );
-
-                    return false;
-                }
-
-                // Otherwise, assume that there is a possibility of re-hiring
-                return true;
-            }();
+            const bool isPossibleToReHire = _commander->isPossibleToReHireAfterBattle();
 
             const int minHeroTotalPrimarySkillLevelForRetreat = 10;
 
@@ -794,7 +758,7 @@ Battle::Actions AI::BattlePlanner::planUnitTurn( Battle::Arena & arena, const Ba
                 }
 
                 // Otherwise, if this hero is relatively experienced, then he should surrender so that he can be hired again later
-                if ( actualHero->getTotalPrimarySkillLevel() >= minHeroTotalPrimarySkillLevelForRetreat ) {
+                if ( _commander->getTotalPrimarySkillLevel() >= minHeroTotalPrimarySkillLevelForRetreat ) {
                     return Outcome::Surrender;
                 }
 
@@ -814,7 +778,7 @@ Battle::Actions AI::BattlePlanner::planUnitTurn( Battle::Arena & arena, const Ba
             }
 
             // Otherwise, if this hero is relatively experienced, then he should retreat so that he can be hired again later
-            if ( actualHero->getTotalPrimarySkillLevel() >= minHeroTotalPrimarySkillLevelForRetreat ) {
+            if ( _commander->getTotalPrimarySkillLevel() >= minHeroTotalPrimarySkillLevelForRetreat ) {
                 return Outcome::Retreat;
             }
 
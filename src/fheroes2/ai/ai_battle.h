@@ -1,6 +1,6 @@
 /***************************************************************************
  *   fheroes2: https://github.com/ihhub/fheroes2                           *
- *   Copyright (C) 2024 - 2025                                             *
+ *   Copyright (C) 2024 - 2026                                             *
  *                                                                         *
  *   This program is free software; you can redistribute it and/or modify  *
  *   it under the terms of the GNU General Public License as published by  *
@@ -70,10 +70,14 @@ namespace AI
         }
     };
 
+    // Every battle arena has its own instance of the battle planner so several battles can be processed at the same time.
     class BattlePlanner
     {
     public:
-        static BattlePlanner & Get();
+        BattlePlanner() = default;
+        BattlePlanner( const BattlePlanner & ) = delete;
+
+        BattlePlanner & operator=( const BattlePlanner & ) = delete;
 
         // Should be called at the beginning of the battle
         void battleBegins();
@@ -81,8 +85,6 @@ namespace AI
         void BattleTurn( Battle::Arena & arena, const Battle::Unit & currentUnit, Battle::Actions & actions );
 
     private:
-        BattlePlanner() = default;
-
         // Checks whether the limit of turns is exceeded for the attacking AI-controlled
         // hero and inserts an appropriate action to the action list if necessary
         bool isLimitOfTurnsExceeded( const Battle::Arena & arena, Battle::Actions & actions );
@@ -0,0 +1,497 @@
+/***************************************************************************
+ *   fheroes2: https://github.com/ihhub/fheroes2                           *
+ *   Copyright (C) 2026                                                    *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include "ai_battle_estimator.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "army.h"
+#include "army_troop.h"
+#include "artifact.h"
+#include "battle.h"
+#include "battle_arena.h"
+#include "battle_army.h"
+#include "game.h"
+#include "heroes_base.h"
+#include "logging.h"
+#include "players.h"
+#include "rand.h"
+#include "skill.h"
+#include "spell.h"
+#include "spell_book.h"
+#include "thread.h"
+#include "world.h"
+
+namespace
+{
+    // The maximum number of cached estimates.
+    const size_t maxCachedEstimateCount{ 4096 };
+
+    // A copy of the commander of an army which is used in battle simulations. The original commander is not modified by the simulated battle.
+    class SimulatedCommander final : public HeroBase
+    {
+    public:
+        SimulatedCommander( const HeroBase & original, Army & army )
+            : _original( original )
+            , _army( army )
+            , _name( original.GetName() )
+            , _attackValue( original.GetAttack() )
+            , _defenseValue( original.GetDefense() )
+            , _powerValue( original.GetPower() )
+            , _knowledgeValue( original.GetKnowledge() )
+            , _moraleValue( original.GetMorale() )
+            , _luckValue( original.GetLuck() )
+        {
+            // The base values of primary skills are used by AI to decide whether the commander should retreat or surrender.
+            Skill::Primary::operator=( original );
+
+            _spellPoints = original.GetSpellPoints();
+            _bagArtifacts = original.GetBagArtifacts();
+
+            const SpellStorage & spells = original.getMagicBookSpells();
+            _spellBook.assign( spells.begin(), spells.end() );
+        }
+
+        SimulatedCommander( const SimulatedCommander & ) = delete;
+
+        ~SimulatedCommander() override = default;
+
+        SimulatedCommander & operator=( const SimulatedCommander & ) = delete;
+
+        int GetAttack() const override
+        {
+            return _attackValue;
+        }
+
+        int GetDefense() const override
+        {
+            return _defenseValue;
+        }
+
+        int GetPower() const override
+        {
+            return _powerValue;
+        }
+
+        int GetKnowledge() const override
+        {
+            return _knowledgeValue;
+        }
+
+        int GetMorale() const override
+        {
+            return _moraleValue;
+        }
+
+        int GetLuck() const override
+        {
+            return _luckValue;
+        }
+
+        int GetRace() const override
+        {
+            return _original.GetRace();
+        }
+
+        const std::string & GetName() const override
+        {
+            return _name;
+        }
+
+        PlayerColor GetColor() const override
+        {
+            return _original.GetColor();
+        }
+
+        // Both armies are always controlled by AI in simulated battles.
+        int GetControl() const override
+        {
+            return CONTROL_AI;
+        }
+
+        bool isValid() const override
+        {
+            return true;
+        }
+
+        const Army & GetArmy() const override
+        {
+            return _army;
+        }
+
+        Army & GetArmy() override
+        {
+            return _army;
+        }
+
+        uint32_t GetMaxSpellPoints() const override
+        {
+            return _original.GetMaxSpellPoints();
+        }
+
+        int GetLevelSkill( int skill ) const override
+        {
+            return _original.GetLevelSkill( skill );
+        }
+
+        uint32_t GetSecondarySkillValue( int skill ) const override
+        {
+            return _original.GetSecondarySkillValue( skill );
+        }
+
+        void ActionAfterBattle() override
+        {
+            // Do nothing.
+        }
+
+        void ActionPreBattle() override
+        {
+            // Do nothing.
+        }
+
+        const Castle * inCastle() const override
+        {
+            return _original.inCastle();
+        }
+
+        bool isAbleToPaySurrenderCost( const uint32_t cost ) const override
+        {
+            return _original.isAbleToPaySurrenderCost( cost );
+        }
+
+        void paySurrenderCost( const uint32_t /* cost */, const PlayerColor /* receiverColor */ ) override
+        {
+            // Simulated battles do not affect kingdoms.
+        }
+
+        bool isPossibleToReHireAfterBattle() const override
+        {
+            return _original.isPossibleToReHireAfterBattle();
+        }
+
+        void PortraitRedraw( const int32_t /* px */, const int32_t /* py */, const PortraitType /* type */, fheroes2::Image & /* dstsf */ ) const override
+        {
+            // Simulated battles have no interface.
+            assert( 0 );
+        }
+
+        int GetType() const override
+        {
+            return _original.GetType();
+        }
+
+    private:
+        const HeroBase & _original;
+        Army & _army;
+
+        const std::string _name;
+
+        // Values of these skills depend on the state of the original commander (e.g. artifacts or the composition of the army), so they are stored.
+        const int _attackValue;
+        const int _defenseValue;
+        const int _powerValue;
+        const int _knowledgeValue;
+        const int _moraleValue;
+        const int _luckValue;
+    };
+
+    struct SimulationResult
+    {
+        bool isCompleted{ false };
+        bool isAttackerWin{ false };
+        double attackerLoss{ 0.0 };
+        double defenderLoss{ 0.0 };
+    };
+
+    double getTroopsStrength( const Troops & troops )
+    {
+        double strength = 0.0;
+
+        for ( size_t i = 0; i < troops.Size(); ++i ) {
+            const Troop * troop = troops.GetTroop( i );
+            if ( troop != nullptr && troop->isValid() ) {
+                strength += troop->GetStrength();
+            }
+        }
+
+        return strength;
+    }
+
+    double getLostStrengthRatio( const double initialStrength, const double remainingStrength )
+    {
+        if ( initialStrength <= 0.0 ) {
+            return 0.0;
+        }
+
+        return std::clamp( 1.0 - remainingStrength / initialStrength, 0.0, 1.0 );
+    }
+
+    void appendArmyToKey( std::vector<uint32_t> & key, const Army & army )
+    {
+        key.push_back( static_cast<uint32_t>( army.GetColor() ) );
+        key.push_back( army.isSpreadFormation() ? 1 : 0 );
+
+        for ( size_t i = 0; i < army.Size(); ++i ) {
+            const Troop * troop = army.GetTroop( i );
+            if ( troop != nullptr && troop->isValid() ) {
+                key.push_back( static_cast<uint32_t>( troop->GetID() ) );
+                key.push_back( troop->GetCount() );
+            }
+            else {
+                key.push_back( 0 );
+                key.push_back( 0 );
+            }
+        }
+
+        const HeroBase * commander = army.GetCommander();
+        if ( commander == nullptr ) {
+            key.push_back( 0 );
+            return;
+        }
+
+        key.push_back( static_cast<uint32_t>( commander->GetType() ) );
+        key.push_back( static_cast<uint32_t>( commander->GetRace() ) );
+        key.push_back( static_cast<uint32_t>( commander->GetAttack() ) );
+        key.push_back( static_cast<uint32_t>( commander->GetDefense() ) );
+        key.push_back( static_cast<uint32_t>( commander->GetPower() ) );
+        key.push_back( static_cast<uint32_t>( commander->GetKnowledge() ) );
+        key.push_back( static_cast<uint32_t>( commander->GetMorale() ) );
+        key.push_back( static_cast<uint32_t>( commander->GetLuck() ) );
+        key.push_back( commander->GetSpellPoints() );
+
+        for ( int skill = Skill::Secondary::PATHFINDING; skill <= Skill::Secondary::ESTATES; ++skill ) {
+            key.push_back( static_cast<uint32_t>( commander->GetLevelSkill( skill ) ) );
+        }
+
+        const SpellStorage & spells = commander->getMagicBookSpells();
+        key.push_back( static_cast<uint32_t>( spells.size() ) );
+        for ( const Spell & spell : spells ) {
+            key.push_back( static_cast<uint32_t>( spell.GetID() ) );
+        }
+
+        const BagArtifacts & artifacts = commander->GetBagArtifacts();
+        key.push_back( static_cast<uint32_t>( artifacts.size() ) );
+        for ( const Artifact & artifact : artifacts ) {
+            key.push_back( static_cast<uint32_t>( artifact.GetID() ) );
+        }
+    }
+
+    class BattleOutcomeEstimateCache
+    {
+    public:
+        bool get( const std::vector<uint32_t> & key, AI::BattleOutcomeEstimate & estimate )
+        {
+            const std::scoped_lock<std::mutex> lock( _mutex );
+
+            const auto iter = _estimates.find( key );
+            if ( iter == _estimates.end() ) {
+                return false;
+            }
+
+            // An estimate which has been interrupted by the time limit before any battle was simulated is useless.
+            // Otherwise it is used as is, since repeating the estimate would most likely be interrupted again.
+            if ( iter->second.estimate.simulationCount == 0 ) {
+                return false;
+            }
+
+            // Mark the estimate as the most recently used one.
+            _usageOrder.splice( _usageOrder.end(), _usageOrder, iter->second.usageOrderIter );
+
+            estimate = iter->second.estimate;
+            return true;
+        }
+
+        void set( const std::vector<uint32_t> & key, const AI::BattleOutcomeEstimate & estimate )
+        {
+            const std::scoped_lock<std::mutex> lock( _mutex );
+
+            const auto iter = _estimates.find( key );
+            if ( iter != _estimates.end() ) {
+                iter->second.estimate = estimate;
+                _usageOrder.splice( _usageOrder.end(), _usageOrder, iter->second.usageOrderIter );
+
+                return;
+            }
+
+            // The least recently used estimates are evicted to keep memory usage bounded.
+            while ( _estimates.size() >= maxCachedEstimateCount ) {
+                assert( !_usageOrder.empty() );
+
+                _estimates.erase( _usageOrder.front() );
+                _usageOrder.pop_front();
+            }
+
+            _estimates.try_emplace( key, CachedEstimate{ estimate, _usageOrder.insert( _usageOrder.end(), key ) } );
+        }
+
+    private:
+        struct CachedEstimate
+        {
+            AI::BattleOutcomeEstimate estimate;
+            std::list<std::vector<uint32_t>>::iterator usageOrderIter;
+        };
+
+        std::map<std::vector<uint32_t>, CachedEstimate> _estimates;
+
+        // Keys of cached estimates from the least to the most recently used.
+        std::list<std::vector<uint32_t>> _usageOrder;
+
+        std::mutex _mutex;
+    };
+
+    BattleOutcomeEstimateCache estimateCache;
+}
+
+AI::SimulatedArmy::SimulatedArmy( const Army & original )
+    : _army( std::make_unique<Army>() )
+{
+    _army->Assign( original );
+    _army->SetColor( original.GetColor() );
+    _army->SetSpreadFormation( original.isSpreadFormation() );
+
+    const HeroBase * commander = original.GetCommander();
+    if ( commander != nullptr ) {
+        _commander = std::make_unique<SimulatedCommander>( *commander, *_army );
+        _army->SetCommander( _commander.get() );
+    }
+}
+
+AI::SimulatedArmy::~SimulatedArmy() = default;
+
+AI::BattleOutcomeEstimate AI::estimateBattleOutcome( const Army & attackingArmy, const Army & defendingArmy, const int32_t tileIndex, const uint32_t simulationCount,
+                                                     const std::chrono::milliseconds timeBudget /* = std::chrono::milliseconds::zero() */ )
+{
+    assert( simulationCount > 0 );
+
+    if ( !attackingArmy.isValid() || !defendingArmy.isValid() ) {
+        BattleOutcomeEstimate estimate;
+        estimate.attackerWinProbability = defendingArmy.isValid() ? 0.0 : 1.0;
+
+        return estimate;
+    }
+
+    std::vector<uint32_t> key{ static_cast<uint32_t>( tileIndex ), world.GetMapSeed(), static_cast<uint32_t>( Game::getDifficulty() ) };
+    appendArmyToKey( key, attackingArmy );
+    appendArmyToKey( key, defendingArmy );
+
+    BattleOutcomeEstimate estimate;
+    if ( estimateCache.get( key, estimate ) ) {
+        return estimate;
+    }
+
+    uint32_t baseSeed = 0;
+    for ( const uint32_t value : key ) {
+        Rand::combineSeedWithValueHash( baseSeed, value );
+    }
+
+    const double attackerInitialStrength = getTroopsStrength( attackingArmy );
+    const double defenderInitialStrength = getTroopsStrength( defendingArmy );
+
+    const auto deadline = std::chrono::steady_clock::now() + timeBudget;
+    const bool isTimeLimited = ( timeBudget > std::chrono::milliseconds::zero() );
+
+    std::atomic<bool> isTimeOver{ false };
+    std::vector<SimulationResult> results( simulationCount );
+
+    const auto simulateBattle = [&]( const size_t taskId, const size_t /* workerId */ ) {
+        if ( isTimeOver ) {
+            return;
+        }
+
+        if ( isTimeLimited && std::chrono::steady_clock::now() >= deadline ) {
+            isTimeOver = true;
+            return;
+        }
+
+        SimulatedArmy attacker( attackingArmy );
+        SimulatedArmy defender( defendingArmy );
+
+        uint32_t seed = baseSeed;
+        Rand::combineSeedWithValueHash( seed, static_cast<uint32_t>( taskId ) );
+
+        Rand::PCG32 randomGenerator( seed );
+
+        Battle::Arena arena( attacker.get(), defender.get(), tileIndex, false, randomGenerator );
+
+        while ( arena.BattleValid() ) {
+            arena.Turns();
+        }
+
+        arena.getAttackingForce().syncOriginalArmy();
+        arena.getDefendingForce().syncOriginalArmy();
+
+        SimulationResult & result = results[taskId];
+
+        result.isCompleted = true;
+        result.isAttackerWin = arena.GetResult().isAttackerWin();
+        result.attackerLoss = getLostStrengthRatio( attackerInitialStrength, getTroopsStrength( attacker.get() ) );
+        result.defenderLoss = getLostStrengthRatio( defenderInitialStrength, getTroopsStrength( defender.get() ) );
+    };
+
+    if ( MultiThreading::WorkerPool::isTaskThread() ) {
+        // This estimate is a part of a computation which is already being performed in parallel (e.g. the evaluation of hero targets),
+        // so the simulations are run on the current thread to avoid the oversubscription.
+        for ( size_t taskId = 0; taskId < simulationCount; ++taskId ) {
+            simulateBattle( taskId, 0 );
+        }
+    }
+    else {
+        MultiThreading::getSharedWorkerPool().execute( simulationCount, simulateBattle, {} );
+    }
+
+    for ( const SimulationResult & result : results ) {
+        if ( !result.isCompleted ) {
+            continue;
+        }
+
+        ++estimate.simulationCount;
+
+        if ( result.isAttackerWin ) {
+            estimate.attackerWinProbability += 1.0;
+        }
+
+        estimate.attackerExpectedLoss += result.attackerLoss;
+        estimate.defenderExpectedLoss += result.defenderLoss;
+    }
+
+    if ( estimate.simulationCount > 0 ) {
+        estimate.attackerWinProbability /= estimate.simulationCount;
+        estimate.attackerExpectedLoss /= estimate.simulationCount;
+        estimate.defenderExpectedLoss /= estimate.simulationCount;
+    }
+
+    DEBUG_LOG( DBG_AI, DBG_TRACE,
+               "attacking army: " << attackingArmy.String() << ", defending army: " << defendingArmy.String() << ", simulations: " << estimate.simulationCount
+                                  << ", win probability: " << estimate.attackerWinProbability << ", attacker losses: " << estimate.attackerExpectedLoss
+                                  << ", defender losses: " << estimate.defenderExpectedLoss )
+
+    estimateCache.set( key, estimate );
+
+    return estimate;
+}
@@ -0,0 +1,76 @@
+/***************************************************************************
+ *   fheroes2: https://github.com/ihhub/fheroes2                           *
+ *   Copyright (C) 2026                                                    *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+class Army;
+class HeroBase;
+
+namespace AI
+{
+    // A copy of an army and its commander which can be used in battles without the interface. The original army and its commander
+    // are not modified by such battles. The commander of the copy is always controlled by AI.
+    class SimulatedArmy
+    {
+    public:
+        explicit SimulatedArmy( const Army & original );
+        SimulatedArmy( const SimulatedArmy & ) = delete;
+
+        ~SimulatedArmy();
+
+        SimulatedArmy & operator=( const SimulatedArmy & ) = delete;
+
+        Army & get()
+        {
+            return *_army;
+        }
+
+    private:
+        std::unique_ptr<Army> _army;
+        std::unique_ptr<HeroBase> _commander;
+    };
+
+    struct BattleOutcomeEstimate
+    {
+        // The number of simulated battles. It can be less than the requested number if the time budget has been exhausted.
+        uint32_t simulationCount{ 0 };
+
+        // The share of simulated battles won by the attacking army, in the range [0; 1].
+        double attackerWinProbability{ 0.0 };
+
+        // The expected share of the strength of each army lost in the battle, in the range [0; 1].
+        double attackerExpectedLoss{ 0.0 };
+        double defenderExpectedLoss{ 0.0 };
+    };
+
+    // Estimates the outcome of the battle between the given armies on the given tile by simulating this battle several times without the interface,
+    // with both armies controlled by AI. The original armies and their commanders are not modified. Simulations are run in parallel, unless
+    // the current thread is already executing a task of a worker pool, and no new simulations are started once the time budget is exhausted
+    // (a zero budget means no limit). Without the time budget the estimate is reproducible.
+    //
+    // Estimates are cached by the composition of the armies, the state of their commanders and the battlefield, so repeated queries are free.
+    // This function is thread-safe provided that the armies, their commanders and the world are not modified while it is running.
+    BattleOutcomeEstimate estimateBattleOutcome( const Army & attackingArmy, const Army & defendingArmy, const int32_t tileIndex, const uint32_t simulationCount,
+                                                 const std::chrono::milliseconds timeBudget = std::chrono::milliseconds::zero() );
+}
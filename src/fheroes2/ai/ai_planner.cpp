@@ -24,6 +24,7 @@
 #include <cassert>
 #include <cstdint>
 #include <map>
+#include <mutex>
 #include <utility>
 #include <vector>
 
@@ -73,16 +74,28 @@ void AI::Planner::revealFog( const Maps::Tile & tile, const Kingdom & kingdom )
 
 double AI::Planner::getTileArmyStrength( const Maps::Tile & tile )
 {
-    const auto [iter, inserted] = _tileArmyStrengthValues.try_emplace( tile.GetIndex(), 0.0 );
-    if ( inserted ) {
-        // Creating an Army instance is a relatively heavy operation, so cache it to speed up calculations
-        static Army tileArmy;
-        tileArmy.setFromTile( tile );
+    const int32_t tileIndex = tile.GetIndex();
 
-        iter->second = tileArmy.GetStrength();
+    {
+        const std::scoped_lock<std::mutex> lock( _tileArmyStrengthMutex );
+
+        const auto iter = _tileArmyStrengthValues.find( tileIndex );
+        if ( iter != _tileArmyStrengthValues.end() ) {
+            return iter->second;
+        }
     }
 
-    return iter->second;
+    // Creating an Army instance is a relatively heavy operation, so cache it to speed up calculations.
+    // The strength is calculated without holding the lock, so several threads can do it at the same time.
+    thread_local Army tileArmy;
+    tileArmy.setFromTile( tile );
+
+    const double strength = tileArmy.GetStrength();
+
+    const std::scoped_lock<std::mutex> lock( _tileArmyStrengthMutex );
+
+    // Another thread might have already calculated the same value in the meantime.
+    return _tileArmyStrengthValues.try_emplace( tileIndex, strength ).first->second;
 }
 
 double AI::Planner::getResourcePriorityModifier( const int resource, const bool isMine ) const
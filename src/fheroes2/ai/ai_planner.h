@@ -23,6 +23,8 @@
 #include <array>
 #include <cassert>
 #include <cstdint>
+#include <memory>
+#include <mutex>
 #include <set>
 #include <unordered_map>
 #include <utility>
@@ -178,6 +180,11 @@ namespace AI
             _pathfinder.reset();
         }
 
+        void invalidatePathfinderTile( const int32_t tileIndex )
+        {
+            _pathfinder.invalidateTile( tileIndex );
+        }
+
         void revealFog( const Maps::Tile & tile, const Kingdom & kingdom );
 
         bool isValidHeroObject( const Heroes & hero, const int32_t index, const bool underHero );
@@ -189,7 +196,8 @@ namespace AI
                                      const uint32_t distanceToObject ) const;
 
         // Returns the strength of the army guarding the given tile. Note that the army is obtained by calling
-        // Army::setFromTile(), so this method is not suitable for hero armies or castle garrisons.
+        // Army::setFromTile(), so this method is not suitable for hero armies or castle garrisons. This method
+        // is thread-safe.
         double getTileArmyStrength( const Maps::Tile & tile );
 
         static void HeroesPreBattle( HeroBase & hero, bool isAttacking );
@@ -215,14 +223,20 @@ namespace AI
 
         std::vector<AICastle> getSortedCastleList( const VecCastles & castles, const std::set<int> & castlesInDanger );
 
-        int getPriorityTarget( Heroes & hero, double & maxPriority );
+        // Finds the most valuable target for the given hero using the given pathfinder. This method is called for several
+        // heroes at the same time from different threads, so it must not modify the state of the planner (except for the
+        // thread-safe caches), the heroes, or the world.
+        int getPriorityTarget( const Heroes & hero, double & maxPriority, AIWorldPathfinder & pathfinder );
 
-        double getGeneralObjectValue( const Heroes & hero, const int32_t index, const double valueToIgnore, const uint32_t distanceToObject ) const;
-        double getFighterObjectValue( const Heroes & hero, const int32_t index, const double valueToIgnore, const uint32_t distanceToObject ) const;
-        double getCourierObjectValue( const Heroes & hero, const int32_t index, const double valueToIgnore, const uint32_t distanceToObject ) const;
-        double getScoutObjectValue( const Heroes & hero, const int32_t index, const double valueToIgnore, const uint32_t distanceToObject ) const;
+        // Returns the value of the object on the given tile. The tile does not have to be a world tile: it can be a modified copy of it.
+        double getObjectValue( const Heroes & hero, const Maps::Tile & tile, const double valueToIgnore, const uint32_t distanceToObject ) const;
 
-        int getCourierMainTarget( const Heroes & hero, const double lowestPossibleValue );
+        double getGeneralObjectValue( const Heroes & hero, const Maps::Tile & tile, const double valueToIgnore, const uint32_t distanceToObject ) const;
+        double getFighterObjectValue( const Heroes & hero, const Maps::Tile & tile, const double valueToIgnore, const uint32_t distanceToObject ) const;
+        double getCourierObjectValue( const Heroes & hero, const Maps::Tile & tile, const double valueToIgnore, const uint32_t distanceToObject ) const;
+        double getScoutObjectValue( const Heroes & hero, const Maps::Tile & tile, const double valueToIgnore, const uint32_t distanceToObject ) const;
+
+        int getCourierMainTarget( const Heroes & hero, const double lowestPossibleValue, AIWorldPathfinder & pathfinder );
 
         double getResourcePriorityModifier( const int resource, const bool isMine ) const;
         double getFundsValueBasedOnPriority( const Funds & funds ) const;
@@ -272,11 +286,15 @@ namespace AI
         // during the same turn, but its calculation is a heavy operation, so it needs to be cached to speed up estimations.
         // It is important to update this cache after performing an action on the corresponding tile.
         std::unordered_map<int32_t, double> _tileArmyStrengthValues;
+        std::mutex _tileArmyStrengthMutex;
 
         std::vector<RegionStats> _regions;
 
         std::array<BudgetEntry, 7> _budget = { Resource::WOOD, Resource::MERCURY, Resource::ORE, Resource::SULFUR, Resource::CRYSTAL, Resource::GEMS, Resource::GOLD };
 
         AIWorldPathfinder _pathfinder;
+
+        // Pathfinders used to evaluate the targets of heroes in parallel, one per worker thread.
+        std::vector<std::unique_ptr<AIWorldPathfinder>> _workerPathfinders;
     };
 }
@@ -24,8 +24,9 @@
 #include <cstddef>
 #include <cstdint>
 #include <functional>
-#include <list>
+#include <limits>
 #include <map>
+#include <memory>
 #include <ostream>
 #include <set>
 #include <string>
@@ -33,6 +34,7 @@
 #include <utility>
 #include <vector>
 
+#include "ai_battle_estimator.h"
 #include "ai_common.h"
 #include "ai_hero_action.h"
 #include "ai_planner.h" // IWYU pragma: associated
@@ -74,40 +76,13 @@
 #include "settings.h"
 #include "skill.h"
 #include "spell.h"
+#include "thread.h"
 #include "visit.h"
 #include "world.h"
 #include "world_pathfinding.h"
 
 namespace
 {
-    class TileRestorer final
-    {
-    public:
-        TileRestorer() = delete;
-
-        explicit TileRestorer( Maps::Tile & tile )
-            : _originalTile( tile )
-            , _copyTile( tile )
-        {
-            // Do nothing.
-        }
-
-        TileRestorer( const TileRestorer & ) = delete;
-
-        TileRestorer( TileRestorer && ) = delete;
-
-        TileRestorer & operator=( const TileRestorer & ) = delete;
-
-        ~TileRestorer()
-        {
-            _originalTile = std::move( _copyTile );
-        }
-
-    private:
-        Maps::Tile & _originalTile;
-        Maps::Tile _copyTile;
-    };
-
     int32_t daysToNextWeek()
     {
         const int32_t currentDay = ( static_cast<int32_t>( world.CountDay() ) % numOfDaysPerWeek );
@@ -119,7 +94,7 @@ namespace
         return numOfDaysPerWeek - currentDay + 1;
     }
 
-    int32_t completedDaysToTarget( const std::list<Route::Step> & steps, const Heroes & hero )
+    int32_t completedDaysToTarget( const std::vector<Route::Step> & steps, const Heroes & hero )
     {
         int32_t days{ 0 };
         uint32_t currentMovePoints = hero.GetMovePoints();
@@ -214,7 +189,7 @@ namespace
     {
         const uint32_t regularMovementDist = pathfinder.getDistance( index );
 
-        const std::list<Route::Step> dimensionDoorPath = pathfinder.buildDimensionDoorPath( index );
+        const std::vector<Route::Step> dimensionDoorPath = pathfinder.buildDimensionDoorPath( index );
         if ( dimensionDoorPath.empty() ) {
             return { regularMovementDist, false };
         }
@@ -263,6 +238,32 @@ namespace
         return heroArmyStrength > ai.getTileArmyStrength( tile ) * targetStrengthMultiplier;
     }
 
+    // The number of battles simulated to estimate the outcome of a battle. There is no time limit to keep AI decisions reproducible.
+    const uint32_t battleSimulationCount{ 8 };
+
+    const double minimalBattleWinProbability{ 0.9 };
+    const double maximalBattleExpectedLoss{ 0.35 };
+
+    bool isHeroAbleToDefeatMonsters( const Heroes & hero, const Maps::Tile & tile, AI::Planner & ai, const double heroArmyStrength,
+                                     const double targetStrengthMultiplier )
+    {
+        if ( isHeroStrongerThan( tile, ai, heroArmyStrength, targetStrengthMultiplier ) ) {
+            return true;
+        }
+
+        if ( !isHeroStrongerThan( tile, ai, heroArmyStrength, AI::ARMY_ADVANTAGE_DESPERATE ) ) {
+            return false;
+        }
+
+        // The strength of an army does not take into account spells of the hero, morale, luck or castle walls. If the hero is not clearly
+        // stronger than monsters but not hopelessly weaker either, simulate the battle to make the decision.
+        const Army monsters( tile );
+
+        const AI::BattleOutcomeEstimate estimate = AI::estimateBattleOutcome( hero.GetArmy(), monsters, tile.GetIndex(), battleSimulationCount );
+
+        return estimate.attackerWinProbability >= minimalBattleWinProbability && estimate.attackerExpectedLoss <= maximalBattleExpectedLoss;
+    }
+
     bool isArmyValuableToObtain( const Troop & monster, double armyStrengthThreshold, const bool armyHasMonster )
     {
         if ( armyHasMonster ) {
@@ -690,7 +691,7 @@ namespace
             break;
 
         case MP2::OBJ_MONSTER:
-            return isHeroStrongerThan( tile, ai, heroArmyStrength, ( hero.isLosingGame() ? 1.0 : AI::ARMY_ADVANTAGE_MEDIUM ) );
+            return isHeroAbleToDefeatMonsters( hero, tile, ai, heroArmyStrength, ( hero.isLosingGame() ? 1.0 : AI::ARMY_ADVANTAGE_MEDIUM ) );
 
         case MP2::OBJ_HERO: {
             const Heroes * otherHero = tile.getHero();
@@ -812,6 +813,11 @@ namespace
         return 0;
     }
 
+    double getLowestPossibleTargetValue()
+    {
+        return -1.0 * Maps::Ground::slowestMovePenalty * world.getSize();
+    }
+
     void addHeroToMove( Heroes * hero, std::vector<Heroes *> & availableHeroes )
     {
         if ( hero->Modes( Heroes::PATROL ) && ( hero->GetPatrolDistance() == 0 ) ) {
@@ -1126,11 +1132,11 @@ namespace
 }
 
 // TODO: In the future we need to come up with dynamic object value estimation based not only on a hero's role but on an outcome from movement at certain position.
-double AI::Planner::getGeneralObjectValue( const Heroes & hero, const int32_t index, const double valueToIgnore, const uint32_t distanceToObject ) const
+double AI::Planner::getGeneralObjectValue( const Heroes & hero, const Maps::Tile & tile, const double valueToIgnore, const uint32_t distanceToObject ) const
 {
     // In the future these hardcoded values could be configured by the mod
     // 1 tile distance is 100.0 value approximately
-    const Maps::Tile & tile = world.getTile( index );
+    const int32_t index = tile.GetIndex();
     const MP2::MapObjectType objectType = tile.getMainObjectType();
 
     const std::function<double( const Castle * )> calculateCastleValue = [this, &hero, &calculateCastleValue]( const Castle * castle ) {
@@ -1762,12 +1768,12 @@ double AI::Planner::getGeneralObjectValue( const Heroes & hero, const int32_t in
     return 0;
 }
 
-double AI::Planner::getFighterObjectValue( const Heroes & hero, const int32_t index, const double valueToIgnore, const uint32_t distanceToObject ) const
+double AI::Planner::getFighterObjectValue( const Heroes & hero, const Maps::Tile & tile, const double valueToIgnore, const uint32_t distanceToObject ) const
 {
     // Fighters have higher priority for battles and smaller values for other objects.
     assert( hero.getAIRole() == Heroes::Role::FIGHTER || hero.getAIRole() == Heroes::Role::CHAMPION );
 
-    const Maps::Tile & tile = world.getTile( index );
+    const int32_t index = tile.GetIndex();
     const MP2::MapObjectType objectType = tile.getMainObjectType();
 
     const std::function<double( const Castle * )> calculateCastleValue = [this, &hero, &calculateCastleValue]( const Castle * castle ) {
@@ -2007,7 +2013,7 @@ double AI::Planner::getFighterObjectValue( const Heroes & hero, const int32_t in
         return 1250.0;
     }
     case MP2::OBJ_OBSERVATION_TOWER: {
-        return getGeneralObjectValue( hero, index, valueToIgnore, distanceToObject ) / 2;
+        return getGeneralObjectValue( hero, tile, valueToIgnore, distanceToObject ) / 2;
     }
     case MP2::OBJ_ARTESIAN_SPRING: {
         if ( !hero.HaveSpellBook() || hero.GetSpellPoints() * 2 >= hero.GetMaxSpellPoints() ) {
@@ -2049,7 +2055,7 @@ double AI::Planner::getFighterObjectValue( const Heroes & hero, const int32_t in
         return 200;
     }
     case MP2::OBJ_HUT_OF_MAGI: {
-        return getGeneralObjectValue( hero, index, valueToIgnore, distanceToObject ) / 2;
+        return getGeneralObjectValue( hero, tile, valueToIgnore, distanceToObject ) / 2;
     }
     case MP2::OBJ_PYRAMID: {
         return 10000;
@@ -2058,10 +2064,10 @@ double AI::Planner::getFighterObjectValue( const Heroes & hero, const int32_t in
         break;
     }
 
-    return getGeneralObjectValue( hero, index, valueToIgnore, distanceToObject );
+    return getGeneralObjectValue( hero, tile, valueToIgnore, distanceToObject );
 }
 
-double AI::Planner::getCourierObjectValue( const Heroes & hero, const int32_t index, const double valueToIgnore, const uint32_t distanceToObject ) const
+double AI::Planner::getCourierObjectValue( const Heroes & hero, const Maps::Tile & tile, const double valueToIgnore, const uint32_t distanceToObject ) const
 {
     // Courier should focus on its main task and visit other objects only if it's close to the destination
     assert( hero.getAIRole() == Heroes::Role::COURIER );
@@ -2071,7 +2077,7 @@ double AI::Planner::getCourierObjectValue( const Heroes & hero, const int32_t in
     const double fiveTiles = 1400;
     const double tenTiles = 3000;
 
-    const Maps::Tile & tile = world.getTile( index );
+    const int32_t index = tile.GetIndex();
     const MP2::MapObjectType objectType = tile.getMainObjectType();
 
     switch ( objectType ) {
@@ -2167,22 +2173,21 @@ double AI::Planner::getCourierObjectValue( const Heroes & hero, const int32_t in
         break;
     }
 
-    return getGeneralObjectValue( hero, index, valueToIgnore, distanceToObject );
+    return getGeneralObjectValue( hero, tile, valueToIgnore, distanceToObject );
 }
 
-double AI::Planner::getScoutObjectValue( const Heroes & hero, const int32_t index, const double valueToIgnore, const uint32_t distanceToObject ) const
+double AI::Planner::getScoutObjectValue( const Heroes & hero, const Maps::Tile & tile, const double valueToIgnore, const uint32_t distanceToObject ) const
 {
     // Courier should focus on its main task and visit other objects only if it's close to the destination
     assert( hero.getAIRole() == Heroes::Role::SCOUT );
 
-    const Maps::Tile & tile = world.getTile( index );
     const MP2::MapObjectType objectType = tile.getMainObjectType();
 
     switch ( objectType ) {
     case MP2::OBJ_WITCHS_HUT: {
         if ( !hero.isVisited( tile, Visit::GLOBAL ) ) {
             // Since this object has not been visited use general value estimation.
-            return getGeneralObjectValue( hero, index, valueToIgnore, distanceToObject );
+            return getGeneralObjectValue( hero, tile, valueToIgnore, distanceToObject );
         }
 
         const Skill::Secondary & skill = getSecondarySkillFromWitchsHut( tile );
@@ -2199,7 +2204,7 @@ double AI::Planner::getScoutObjectValue( const Heroes & hero, const int32_t inde
             return -dangerousTaskPenalty;
         }
 
-        double value = getGeneralObjectValue( hero, index, valueToIgnore, distanceToObject );
+        double value = getGeneralObjectValue( hero, tile, valueToIgnore, distanceToObject );
         if ( skillType == Skill::Secondary::SCOUTING || skillType == Skill::Secondary::LOGISTICS ) {
             // Scouts should focus on scouting so these skills must have much higher priority.
             value = value * 3;
@@ -2214,7 +2219,7 @@ double AI::Planner::getScoutObjectValue( const Heroes & hero, const int32_t inde
         break;
     }
 
-    return getGeneralObjectValue( hero, index, valueToIgnore, distanceToObject );
+    return getGeneralObjectValue( hero, tile, valueToIgnore, distanceToObject );
 }
 
 double AI::Planner::getObjectValue( const Heroes & hero, const int32_t index, const MP2::MapObjectType objectType, const double valueToIgnore,
@@ -2226,16 +2231,21 @@ double AI::Planner::getObjectValue( const Heroes & hero, const int32_t index, co
     (void)objectType;
 #endif
 
+    return getObjectValue( hero, world.getTile( index ), valueToIgnore, distanceToObject );
+}
+
+double AI::Planner::getObjectValue( const Heroes & hero, const Maps::Tile & tile, const double valueToIgnore, const uint32_t distanceToObject ) const
+{
     switch ( hero.getAIRole() ) {
     case Heroes::Role::HUNTER:
-        return getGeneralObjectValue( hero, index, valueToIgnore, distanceToObject );
+        return getGeneralObjectValue( hero, tile, valueToIgnore, distanceToObject );
     case Heroes::Role::SCOUT:
-        return getScoutObjectValue( hero, index, valueToIgnore, distanceToObject );
+        return getScoutObjectValue( hero, tile, valueToIgnore, distanceToObject );
     case Heroes::Role::CHAMPION:
     case Heroes::Role::FIGHTER:
-        return getFighterObjectValue( hero, index, valueToIgnore, distanceToObject );
+        return getFighterObjectValue( hero, tile, valueToIgnore, distanceToObject );
     case Heroes::Role::COURIER:
-        return getCourierObjectValue( hero, index, valueToIgnore, distanceToObject );
+        return getCourierObjectValue( hero, tile, valueToIgnore, distanceToObject );
     default:
         // If you set a new type of a hero you must add the logic here.
         assert( 0 );
@@ -2273,11 +2283,11 @@ double AI::Planner::getFutureObjectValue( const Heroes & hero, const int32_t ind
     case MP2::OBJ_WINDMILL: {
         assert( MP2::isWeekLife( objectType ) );
 
-        Maps::Tile & tile = world.getTile( index );
-        const TileRestorer restorer( tile );
+        // Targets of several heroes are evaluated at the same time, so the world tile must not be modified here.
+        Maps::Tile tile = world.getTile( index );
         Maps::updateObjectInfoTile( tile, false );
 
-        return getObjectValue( hero, index, objectType, valueToIgnore, distanceToObject );
+        return getObjectValue( hero, tile, valueToIgnore, distanceToObject );
     }
     default:
         break;
@@ -2286,7 +2296,7 @@ double AI::Planner::getFutureObjectValue( const Heroes & hero, const int32_t ind
     return getObjectValue( hero, index, objectType, valueToIgnore, distanceToObject );
 }
 
-int AI::Planner::getCourierMainTarget( const Heroes & hero, const double lowestPossibleValue )
+int AI::Planner::getCourierMainTarget( const Heroes & hero, const double lowestPossibleValue, AIWorldPathfinder & pathfinder )
 {
     assert( hero.getAIRole() == Heroes::Role::COURIER );
 
@@ -2310,7 +2320,7 @@ int AI::Planner::getCourierMainTarget( const Heroes & hero, const double lowestP
 
         const int currentHeroIndex = otherHero->GetIndex();
 
-        const auto [dist, dummy] = getDistanceToTile( _pathfinder, currentHeroIndex );
+        const auto [dist, dummy] = getDistanceToTile( pathfinder, currentHeroIndex );
         if ( dist == 0 || hero.hasMetWithHero( otherHero->GetID() ) ) {
             continue;
         }
@@ -2345,7 +2355,7 @@ int AI::Planner::getCourierMainTarget( const Heroes & hero, const double lowestP
 
         const int currentCastleIndex = castle->GetIndex();
 
-        const auto [dist, dummy] = getDistanceToTile( _pathfinder, currentCastleIndex );
+        const auto [dist, dummy] = getDistanceToTile( pathfinder, currentCastleIndex );
         if ( dist == 0 ) {
             continue;
         }
@@ -2375,11 +2385,11 @@ int AI::Planner::getCourierMainTarget( const Heroes & hero, const double lowestP
     return targetIndex;
 }
 
-int AI::Planner::getPriorityTarget( Heroes & hero, double & maxPriority )
+int AI::Planner::getPriorityTarget( const Heroes & hero, double & maxPriority, AIWorldPathfinder & pathfinder )
 {
     DEBUG_LOG( DBG_AI, DBG_INFO, "Find Adventure Map target for hero " << hero.GetName() << " at current position " << hero.GetIndex() )
 
-    const double lowestPossibleValue = -1.0 * Maps::Ground::slowestMovePenalty * world.getSize();
+    const double lowestPossibleValue = getLowestPossibleTargetValue();
 
     int priorityTarget = -1;
     maxPriority = lowestPossibleValue;
@@ -2402,14 +2412,14 @@ int AI::Planner::getPriorityTarget( Heroes & hero, double & maxPriority )
 #endif
 
     // Pre-calculate penalties for tiles where there is a threat of enemy attack
-    const std::vector<double> enemyThreatPenalties = [this, &hero = std::as_const( hero )]() {
+    const std::vector<double> enemyThreatPenalties = [this, &hero, &pathfinder]() {
         std::vector<double> result( world.getSize(), 0.0 );
 
-        const AIWorldPathfinderStateRestorer pathfinderStateRestorer( _pathfinder );
+        const AIWorldPathfinderStateRestorer pathfinderStateRestorer( pathfinder );
 
         // Use the "optimistic" pathfinder settings for enemy heroes - minimal army advantage, minimal reserve of spell points
-        _pathfinder.setMinimalArmyStrengthAdvantage( ARMY_ADVANTAGE_DESPERATE );
-        _pathfinder.setSpellPointsReserveRatio( 0.0 );
+        pathfinder.setMinimalArmyStrengthAdvantage( ARMY_ADVANTAGE_DESPERATE );
+        pathfinder.setSpellPointsReserveRatio( 0.0 );
 
         const double heroStrength = hero.GetArmy().GetStrength();
 
@@ -2439,14 +2449,14 @@ int AI::Planner::getPriorityTarget( Heroes & hero, double & maxPriority )
 
             if ( !useRoughEstimate ) {
                 // Pre-cache the pathfinder database for the enemy hero
-                _pathfinder.reEvaluateIfNeeded( *enemyArmy.hero );
+                pathfinder.reEvaluateIfNeeded( *enemyArmy.hero );
             }
 
             for ( size_t i = 0; i < result.size(); ++i ) {
                 const int32_t tileIdx = static_cast<int32_t>( i );
                 assert( Maps::isValidAbsIndex( tileIdx ) );
 
-                const auto [distToTile, isTileConsideredSafe] = [this, enemyArmyIdx = enemyArmy.index, enemyArmyMovePointsThreshold, useRoughEstimate, tileIdx]() {
+                const auto [distToTile, isTileConsideredSafe] = [&pathfinder, enemyArmyIdx = enemyArmy.index, enemyArmyMovePointsThreshold, useRoughEstimate, tileIdx]() {
                     // The tile on which the enemy hero is located is always considered unsafe
                     if ( tileIdx == enemyArmyIdx ) {
                         return std::make_pair( static_cast<uint32_t>( 0 ), false );
@@ -2461,7 +2471,7 @@ int AI::Planner::getPriorityTarget( Heroes & hero, double & maxPriority )
                         return std::make_pair( dist, dist > enemyArmyMovePointsThreshold );
                     }
 
-                    const uint32_t dist = _pathfinder.getDistance( tileIdx );
+                    const uint32_t dist = pathfinder.getDistance( tileIdx );
 
                     // When using an accurate estimate, a tile is considered safe if the enemy hero does not have access to it (in particular, if it is hidden from
                     // him in the fog) or he cannot reach it within one turn. The potential ability of the enemy hero to use spells to move to this tile (for example,
@@ -2483,16 +2493,16 @@ int AI::Planner::getPriorityTarget( Heroes & hero, double & maxPriority )
     }();
 
     // Pre-cache the pathfinder database for our hero
-    _pathfinder.reEvaluateIfNeeded( hero );
+    pathfinder.reEvaluateIfNeeded( hero );
 
-    ObjectValidator objectValidator( hero, _pathfinder, *this );
+    ObjectValidator objectValidator( hero, pathfinder, *this );
     ObjectValueStorage valueStorage( hero, *this, lowestPossibleValue );
 
-    const auto getObjectValue = [this, &hero = std::as_const( hero ), &enemyThreatPenalties, &objectValidator,
+    const auto getObjectValue = [this, &hero, &pathfinder, &enemyThreatPenalties, &objectValidator,
                                  &valueStorage]( const int destination, uint32_t & distance, double & value, const MP2::MapObjectType type, const bool isDimensionDoor ) {
         // Dimension door path does not include any objects on the way.
         if ( !isDimensionDoor ) {
-            for ( const IndexObject & pair : _pathfinder.getObjectsOnTheWay( destination ) ) {
+            for ( const IndexObject & pair : pathfinder.getObjectsOnTheWay( destination ) ) {
                 const bool isValidObject = objectValidator.isCurrentlyValid( pair.first );
                 const int32_t dayToBecomeValid = objectValidator.whenGoingToBeValidInDays( pair.first );
 
@@ -2511,7 +2521,7 @@ int AI::Planner::getPriorityTarget( Heroes & hero, double & maxPriority )
                     extraValue = valueStorage.value( pair, 0 );
                 }
                 else {
-                    const auto path = _pathfinder.buildPath( pair.first, false );
+                    const auto path = pathfinder.buildPath( pair.first, false );
                     assert( !path.empty() );
                     assert( path.back().GetIndex() == pair.first );
 
@@ -2559,7 +2569,7 @@ int AI::Planner::getPriorityTarget( Heroes & hero, double & maxPriority )
 
     // Set baseline target if it's a special role
     if ( hero.getAIRole() == Heroes::Role::COURIER ) {
-        if ( const int courierTarget = getCourierMainTarget( hero, lowestPossibleValue ); courierTarget != -1 ) {
+        if ( const int courierTarget = getCourierMainTarget( hero, lowestPossibleValue, pathfinder ); courierTarget != -1 ) {
             // Anything with positive value can override the courier's main task (i.e. castle or mine capture on the way)
             priorityTarget = courierTarget;
             maxPriority = 0;
@@ -2570,8 +2580,8 @@ int AI::Planner::getPriorityTarget( Heroes & hero, double & maxPriority )
             DEBUG_LOG( DBG_AI, DBG_INFO, hero.GetName() << " is a courier with a main target tile at " << priorityTarget )
         }
         else {
-            // If there's nothing to do as a Courier reset the role
-            hero.setAIRole( Heroes::Role::HUNTER );
+            // Couriers without a main target should have already been switched to another role before the evaluation of targets.
+            DEBUG_LOG( DBG_AI, DBG_WARN, hero.GetName() << " is a courier without a main target" )
         }
     }
 
@@ -2584,7 +2594,7 @@ int AI::Planner::getPriorityTarget( Heroes & hero, double & maxPriority )
             continue;
         }
 
-        auto [dist, useDimensionDoor] = getDistanceToTile( _pathfinder, idx );
+        auto [dist, useDimensionDoor] = getDistanceToTile( pathfinder, idx );
         if ( dist == 0 ) {
             continue;
         }
@@ -2595,7 +2605,7 @@ int AI::Planner::getPriorityTarget( Heroes & hero, double & maxPriority )
         }
 
         if ( !isCurrentlyValid ) {
-            const auto path = _pathfinder.buildPath( idx, false );
+            const auto path = pathfinder.buildPath( idx, false );
             assert( !path.empty() );
             assert( path.back().GetIndex() == idx );
 
@@ -2634,7 +2644,7 @@ int AI::Planner::getPriorityTarget( Heroes & hero, double & maxPriority )
 
         // If there is an action object on this tile (e.g. a hero), then this tile should be ignored, and that object should have already been considered
         if ( _mapActionObjects.count( idx ) == 0 ) {
-            auto [dist, useDimensionDoor] = getDistanceToTile( _pathfinder, idx );
+            auto [dist, useDimensionDoor] = getDistanceToTile( pathfinder, idx );
 
             if ( dist > 0 ) {
                 double value = ( isFindUltimateArtifactVictoryCondition() ? 3000.0 : 1500.0 ) * art.getArtifactValue();
@@ -2654,8 +2664,8 @@ int AI::Planner::getPriorityTarget( Heroes & hero, double & maxPriority )
     }
 
     // TODO: add logic to check fog discovery based on Dimension Door distance, not the nearest tile.
-    if ( const auto [idx, isTerritoryExpansion] = _pathfinder.getFogDiscoveryTile( hero ); Maps::isValidAbsIndex( idx ) ) {
-        auto [dist, useDimensionDoor] = getDistanceToTile( _pathfinder, idx );
+    if ( const auto [idx, isTerritoryExpansion] = pathfinder.getFogDiscoveryTile( hero ); Maps::isValidAbsIndex( idx ) ) {
+        auto [dist, useDimensionDoor] = getDistanceToTile( pathfinder, idx );
         assert( dist > 0 );
 
         double value = getFogDiscoveryValue( hero );
@@ -2700,7 +2710,7 @@ int AI::Planner::getPriorityTarget( Heroes & hero, double & maxPriority )
         if ( hero.Modes( Heroes::PATROL ) && hero.GetPatrolCenter() != hero.GetCenter() ) {
             const int32_t patrolIndex = hero.GetPatrolCenter().x + hero.GetPatrolCenter().y * world.w();
 
-            auto [dist, useDimensionDoor] = getDistanceToTile( _pathfinder, patrolIndex );
+            auto [dist, useDimensionDoor] = getDistanceToTile( pathfinder, patrolIndex );
             if ( dist == 0 || MP2::isOffGameActionObject( world.getTile( patrolIndex ).getMainObjectType() ) ) {
                 DEBUG_LOG( DBG_AI, DBG_INFO, hero.GetName() << " can't find a meaningful tile to visit and cannot return to the patrol position" )
                 return -1;
@@ -3095,6 +3105,13 @@ fheroes2::GameMode AI::Planner::HeroesTurn( VecHeroes & heroes, uint32_t & curre
 
     uint32_t turnProgressScale = 4 * ( endProgressValue - startProgressValue );
 
+    // Targets of heroes are evaluated in parallel, every worker thread uses its own pathfinder which is created on first use.
+    MultiThreading::WorkerPool & workerPool = MultiThreading::getSharedWorkerPool();
+
+    if ( _workerPathfinders.size() < workerPool.getWorkerCount() ) {
+        _workerPathfinders.resize( workerPool.getWorkerCount() );
+    }
+
     while ( !availableHeroes.empty() ) {
         const AIWorldPathfinderStateRestorer pathfinderStateRestorer( _pathfinder );
 
@@ -3113,20 +3130,69 @@ fheroes2::GameMode AI::Planner::HeroesTurn( VecHeroes & heroes, uint32_t & curre
                 _pathfinder.setMinimalArmyStrengthAdvantage( minStrengthAdvantage );
                 _pathfinder.setSpellPointsReserveRatio( spReserveRatio );
 
+                // The role of a hero affects the evaluation of targets of other heroes, so couriers without a main target are switched
+                // to another role before the parallel evaluation.
+                for ( Heroes * hero : availableHeroes ) {
+                    if ( hero->getAIRole() != Heroes::Role::COURIER ) {
+                        continue;
+                    }
+
+                    _pathfinder.reEvaluateIfNeeded( *hero );
+
+                    if ( getCourierMainTarget( *hero, getLowestPossibleTargetValue(), _pathfinder ) == -1 ) {
+                        hero->setAIRole( Heroes::Role::HUNTER );
+                    }
+                }
+
+                std::vector<std::pair<int, double>> heroTargets( availableHeroes.size(), { -1, -1.0 } );
+
+                const double minimalArmyStrengthAdvantage = minStrengthAdvantage;
+                const double spellPointsReserveRatio = spReserveRatio;
+
+                // Some object values are estimated using random numbers. Every hero gets its own random generator, so the result
+                // does not depend on the thread which evaluates the hero.
+                const uint32_t evaluationSeed = Rand::Get( std::numeric_limits<uint32_t>::max() );
+
+                workerPool.execute(
+                    availableHeroes.size(),
+                    [this, &availableHeroes, &heroTargets, minimalArmyStrengthAdvantage, spellPointsReserveRatio, evaluationSeed]( const size_t heroId,
+                                                                                                                                    const size_t workerId ) {
+                        std::unique_ptr<AIWorldPathfinder> & workerPathfinder = _workerPathfinders[workerId];
+                        if ( !workerPathfinder ) {
+                            workerPathfinder = std::make_unique<AIWorldPathfinder>();
+                        }
+
+                        AIWorldPathfinder & pathfinder = *workerPathfinder;
+
+                        // Tasks are run on the calling thread if there are no worker threads, so its random generator has to be restored.
+                        const Rand::PCG32 threadRandomDevice = Rand::CurrentThreadRandomDevice();
+                        Rand::CurrentThreadRandomDevice() = Rand::PCG32( evaluationSeed, heroId );
+
+                        // The pathfinder is evaluated from scratch for every hero, so that the result does not depend on the heroes previously
+                        // processed by the same worker.
+                        pathfinder.reset();
+                        pathfinder.setMinimalArmyStrengthAdvantage( minimalArmyStrengthAdvantage );
+                        pathfinder.setSpellPointsReserveRatio( spellPointsReserveRatio );
+
+                        auto & [targetIndex, priority] = heroTargets[heroId];
+                        targetIndex = getPriorityTarget( *availableHeroes[heroId], priority, pathfinder );
+
+                        Rand::CurrentThreadRandomDevice() = threadRandomDevice;
+                    },
+                    // These computations may take many time, so pump the event queue and update the animation of the hourglass grains.
+                    [&status, currentProgressValue]() { status.drawAITurnProgress( currentProgressValue ); } );
+
                 double maxPriority = 0;
 
-                for ( Heroes * hero : availableHeroes ) {
-                    double priority = -1;
-                    const int targetIndex = getPriorityTarget( *hero, priority );
+                // Heroes are checked in their original order to keep the choice deterministic regardless of the order in which the evaluation was completed.
+                for ( size_t heroId = 0; heroId < availableHeroes.size(); ++heroId ) {
+                    const auto [targetIndex, priority] = heroTargets[heroId];
 
                     if ( targetIndex != -1 && ( priority > maxPriority || bestTargetIndex == -1 ) ) {
                         maxPriority = priority;
                         bestTargetIndex = targetIndex;
-                        bestHero = hero;
+                        bestHero = availableHeroes[heroId];
                     }
-
-                    // This loop may take many time for computations, so pump the event queue and update the animation of the hourglass grains.
-                    status.drawAITurnProgress( currentProgressValue );
                 }
 
                 if ( bestTargetIndex != -1 ) {
@@ -3186,21 +3252,22 @@ fheroes2::GameMode AI::Planner::HeroesTurn( VecHeroes & heroes, uint32_t & curre
         int prevHeroPosition = bestHero->GetIndex();
 
         {
-            std::list<Route::Step> dimensionDoorPath = _pathfinder.buildDimensionDoorPath( bestTargetIndex );
+            const std::vector<Route::Step> dimensionDoorPath = _pathfinder.buildDimensionDoorPath( bestTargetIndex );
+            auto dimensionDoorStep = dimensionDoorPath.cbegin();
             uint32_t regularMovementDist = _pathfinder.getDistance( bestTargetIndex );
             uint32_t dimensionDoorDist = Route::calculatePathPenalty( dimensionDoorPath );
 
             if ( shouldUseDimensionDoor( regularMovementDist, dimensionDoorDist ) ) {
                 while ( shouldUseDimensionDoor( regularMovementDist, dimensionDoorDist ) ) {
-                    assert( !dimensionDoorPath.empty() && bestHero->MayStillMove( false, false ) );
+                    assert( dimensionDoorStep != dimensionDoorPath.cend() && bestHero->MayStillMove( false, false ) );
 
-                    HeroesCastDimensionDoor( *bestHero, dimensionDoorPath.front().GetIndex() );
-                    dimensionDoorDist -= dimensionDoorPath.front().GetPenalty();
+                    HeroesCastDimensionDoor( *bestHero, dimensionDoorStep->GetIndex() );
+                    dimensionDoorDist -= dimensionDoorStep->GetPenalty();
 
                     _pathfinder.reEvaluateIfNeeded( *bestHero );
                     regularMovementDist = _pathfinder.getDistance( bestTargetIndex );
 
-                    dimensionDoorPath.pop_front();
+                    ++dimensionDoorStep;
 
                     // Hero can jump straight into the fog using the Dimension Door spell, which triggers the mechanics of fog revealing for his new tile
                     // and this results in inserting a new hero position into the action object cache. Perform the necessary updates.
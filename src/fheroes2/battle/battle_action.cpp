@@ -48,18 +48,15 @@
 #include "color.h"
 #include "heroes.h"
 #include "heroes_base.h"
-#include "kingdom.h"
 #include "logging.h"
 #include "monster.h"
 #include "monster_info.h"
 #include "players.h"
 #include "rand.h"
-#include "resource.h"
 #include "spell.h"
 #include "spell_storage.h"
 #include "tools.h"
 #include "translations.h"
-#include "world.h"
 
 namespace
 {
@@ -787,7 +784,7 @@ void Battle::Arena::ApplyActionRetreat( const Command & /* cmd */ )
 
 void Battle::Arena::ApplyActionSurrender( const Command & /* cmd */ )
 {
-    const auto checkPreconditions = []( const Funds & cost ) {
+    const auto checkPreconditions = []( const HeroBase * commander, const uint32_t cost ) {
         const Arena * arena = GetArena();
         assert( arena != nullptr );
 
@@ -795,7 +792,10 @@ void Battle::Arena::ApplyActionSurrender( const Command & /* cmd */ )
             return false;
         }
 
-        if ( !world.GetKingdom( arena->GetCurrentColor() ).AllowPayment( cost ) ) {
+        assert( commander != nullptr );
+
+        // The payment is made through the commander, because the commander of a simulated battle pays nothing to the actual kingdom
+        if ( !commander->isAbleToPaySurrenderCost( cost ) ) {
             return false;
         }
 
@@ -805,11 +805,10 @@ void Battle::Arena::ApplyActionSurrender( const Command & /* cmd */ )
     const PlayerColor currentColor = GetCurrentColor();
 
     if ( _attackingArmy->GetColor() == currentColor ) {
-        Funds cost;
+        HeroBase * commander = _attackingArmy->GetCommander();
+        const uint32_t cost = _attackingArmy->GetSurrenderCost();
 
-        cost.gold = _attackingArmy->GetSurrenderCost();
-
-        if ( !checkPreconditions( cost ) ) {
+        if ( !checkPreconditions( commander, cost ) ) {
             ERROR_LOG( "Preconditions were not met" )
 
 #ifdef WITH_DEBUG
@@ -821,17 +820,15 @@ void Battle::Arena::ApplyActionSurrender( const Command & /* cmd */ )
 
         DEBUG_LOG( DBG_BATTLE, DBG_TRACE, "color: " << Color::String( currentColor ) )
 
-        world.GetKingdom( _attackingArmy->GetColor() ).OddFundsResource( cost );
-        world.GetKingdom( _defendingArmy->GetColor() ).AddFundsResource( cost );
+        commander->paySurrenderCost( cost, _defendingArmy->GetColor() );
 
         _battleResult.attacker = RESULT_SURRENDER;
     }
     else if ( _defendingArmy->GetColor() == currentColor ) {
-        Funds cost;
-
-        cost.gold = _defendingArmy->GetSurrenderCost();
+        HeroBase * commander = _defendingArmy->GetCommander();
+        const uint32_t cost = _defendingArmy->GetSurrenderCost();
 
-        if ( !checkPreconditions( cost ) ) {
+        if ( !checkPreconditions( commander, cost ) ) {
             ERROR_LOG( "Preconditions were not met" )
 
 #ifdef WITH_DEBUG
@@ -843,8 +840,7 @@ void Battle::Arena::ApplyActionSurrender( const Command & /* cmd */ )
 
         DEBUG_LOG( DBG_BATTLE, DBG_TRACE, "color: " << Color::String( currentColor ) )
 
-        world.GetKingdom( _defendingArmy->GetColor() ).OddFundsResource( cost );
-        world.GetKingdom( _attackingArmy->GetColor() ).AddFundsResource( cost );
+        commander->paySurrenderCost( cost, _attackingArmy->GetColor() );
 
         _battleResult.defender = RESULT_SURRENDER;
     }
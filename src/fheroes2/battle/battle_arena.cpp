@@ -70,7 +70,7 @@
 
 namespace
 {
-    Battle::Arena * arena = nullptr;
+    thread_local Battle::Arena * arena = nullptr;
 
     template <typename T>
     Battle::Unit * getLastResurrectableUnitFromGraveyardTmpl( const Battle::Graveyard & graveyard, const HeroBase * commander, const int32_t index, const T & spells )
@@ -347,10 +347,13 @@ Battle::Arena::Arena( Army & attackingArmy, Army & defendingArmy, const int32_t
     : castle( world.getCastleEntrance( Maps::GetPoint( tileIndex ) ) )
     , _isTown( castle != nullptr )
     , _randomGenerator( randomGenerator )
+    , _aiBattlePlanner( std::make_unique<AI::BattlePlanner>() )
+    , _previousArena( arena )
 {
     _usedSpells.reserve( 20 );
 
-    assert( arena == nullptr );
+    // Only one battle with the interface can be processed at a time.
+    assert( !isShowInterface || arena == nullptr );
     arena = this;
 
     _attackingArmy = std::make_unique<Force>( attackingArmy, false, _uidGenerator );
@@ -435,7 +438,7 @@ Battle::Arena::Arena( Army & attackingArmy, Army & defendingArmy, const int32_t
         board.SetCobjObjects( world.getTile( tileIndex ), seededGen );
     }
 
-    AI::BattlePlanner::Get().battleBegins();
+    _aiBattlePlanner->battleBegins();
 
     if ( _interface ) {
         _interface->fullRedraw();
@@ -454,7 +457,7 @@ Battle::Arena::Arena( Army & attackingArmy, Army & defendingArmy, const int32_t
 Battle::Arena::~Arena()
 {
     assert( arena == this );
-    arena = nullptr;
+    arena = _previousArena;
 }
 
 void Battle::Arena::UnitTurn( const Units & orderHistory )
@@ -505,7 +508,7 @@ void Battle::Arena::UnitTurn( const Units & orderHistory )
             }
 
             if ( ( _currentUnit->GetCurrentControl() & CONTROL_AI ) || ( _autoCombatColors & _currentUnit->GetCurrentColor() ) ) {
-                AI::BattlePlanner::Get().BattleTurn( *this, *_currentUnit, actions );
+                _aiBattlePlanner->BattleTurn( *this, *_currentUnit, actions );
             }
             else {
                 assert( _interface != nullptr );
@@ -1,6 +1,6 @@
 /***************************************************************************
  *   fheroes2: https://github.com/ihhub/fheroes2                           *
- *   Copyright (C) 2019 - 2025                                             *
+ *   Copyright (C) 2019 - 2026                                             *
  *                                                                         *
  *   Free Heroes2 Engine: http://sourceforge.net/projects/fheroes2         *
  *   Copyright (C) 2010 by Andrey Afletdinov <fheroes2@gmail.com>          *
@@ -47,6 +47,11 @@ class Artifact;
 class Castle;
 class HeroBase;
 
+namespace AI
+{
+    class BattlePlanner;
+}
+
 namespace Rand
 {
     class PCG32;
@@ -243,6 +248,7 @@ namespace Battle
 
         int32_t GetFreePositionNearHero( const PlayerColor heroColor ) const;
 
+        // These methods return the objects of the arena of the battle which is being processed by the current thread.
         static Board * GetBoard();
         static Tower * GetTower( const TowerType type );
         static Bridge * GetBridge();
@@ -372,11 +378,18 @@ namespace Battle
 
         TroopsUidGenerator _uidGenerator;
 
+        std::unique_ptr<AI::BattlePlanner> _aiBattlePlanner;
+
+        // The arena which was processed by the current thread before this one was created. It is restored when this arena is destroyed.
+        Arena * _previousArena{ nullptr };
+
         enum
         {
             CHAIN_LIGHTNING_CREATURE_COUNT = 4
         };
     };
 
+    // Returns the arena of the battle which is being processed by the current thread, or nullptr if there is no such battle.
+    // Every thread can process its own battle (without the interface) independently of other threads.
     Arena * GetArena();
 }
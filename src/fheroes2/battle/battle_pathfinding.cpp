@@ -25,9 +25,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <functional>
-#include <set>
 #include <tuple>
-#include <vector>
 
 #include "battle_arena.h"
 #include "battle_cell.h"
@@ -73,8 +71,7 @@ namespace Battle
         const Castle * castle = Arena::GetCastle();
         const bool isMoatBuilt = castle && castle->isBuild( BUILD_MOAT );
 
-        _cache.clear();
-        _cache.try_emplace( _pathStart );
+        _nodes.fill( {} );
 
         // Flying units can land wherever they can fit
         if ( _isFlying ) {
@@ -90,13 +87,16 @@ namespace Battle
                 const int32_t headCellIdx = pos.GetHead()->GetIndex();
                 const int32_t tailCellIdx = pos.GetTail() ? pos.GetTail()->GetIndex() : -1;
 
-                if ( const auto [iter, inserted] = _cache.try_emplace( { headCellIdx, tailCellIdx } ); inserted ) {
-                    // Wide units can occupy overlapping positions, the distance between which is actually zero,
-                    // but since the movement takes place, we will consider the distance equal to 1 in this case
-                    const uint32_t distance = std::max<uint32_t>( Board::GetDistance( unit.GetPosition(), pos ), 1U );
-
-                    iter->second.update( _pathStart, 1, distance );
+                const BattleNodeIndex nodeIdx = { headCellIdx, tailCellIdx };
+                if ( isNodeReached( nodeIdx ) ) {
+                    continue;
                 }
+
+                // Wide units can occupy overlapping positions, the distance between which is actually zero,
+                // but since the movement takes place, we will consider the distance equal to 1 in this case
+                const uint32_t distance = std::max<uint32_t>( Board::GetDistance( unit.GetPosition(), pos ), 1U );
+
+                getNode( nodeIdx ).update( _pathStart, 1, distance );
             }
 
             return;
@@ -126,13 +126,13 @@ namespace Battle
             return -1;
         }();
 
-        std::vector<BattleNodeIndex> nodesToExplore;
-        nodesToExplore.reserve( Board::sizeInCells * 2 );
-        nodesToExplore.push_back( _pathStart );
+        _nodesToExplore.clear();
+        _nodesToExplore.reserve( Board::sizeInCells * 2 );
+        _nodesToExplore.push_back( _pathStart );
 
-        for ( size_t nodesToExploreIdx = 0; nodesToExploreIdx < nodesToExplore.size(); ++nodesToExploreIdx ) {
-            const BattleNodeIndex currentNodeIdx = nodesToExplore[nodesToExploreIdx];
-            const BattleNode & currentNode = _cache[currentNodeIdx];
+        for ( size_t nodesToExploreIdx = 0; nodesToExploreIdx < _nodesToExplore.size(); ++nodesToExploreIdx ) {
+            const BattleNodeIndex currentNodeIdx = _nodesToExplore[nodesToExploreIdx];
+            const BattleNode & currentNode = getNode( currentNodeIdx );
 
             if ( _isWide ) {
                 assert( currentNodeIdx.first != -1 && currentNodeIdx.second != -1 );
@@ -169,11 +169,11 @@ namespace Battle
                     const uint32_t cost = currentNode._cost + ( newNodeIdx == flippedCurrentNodeIdx ? 0 : movementPenalty );
                     const uint32_t distance = currentNode._distance + ( newNodeIdx == flippedCurrentNodeIdx ? 0 : 1 );
 
-                    BattleNode & newNode = _cache[newNodeIdx];
+                    BattleNode & newNode = getNode( newNodeIdx );
                     if ( newNode._from == BattleNodeIndex{ -1, -1 } || newNode._cost > cost ) {
                         newNode.update( currentNodeIdx, cost, distance );
 
-                        nodesToExplore.push_back( newNodeIdx );
+                        _nodesToExplore.push_back( newNodeIdx );
                     }
                 }
             }
@@ -206,11 +206,11 @@ namespace Battle
                     const uint32_t cost = currentNode._cost + movementPenalty;
                     const uint32_t distance = currentNode._distance + 1;
 
-                    BattleNode & newNode = _cache[newNodeIdx];
+                    BattleNode & newNode = getNode( newNodeIdx );
                     if ( newNode._from == BattleNodeIndex{ -1, -1 } || newNode._cost > cost ) {
                         newNode.update( currentNodeIdx, cost, distance );
 
-                        nodesToExplore.push_back( newNodeIdx );
+                        _nodesToExplore.push_back( newNodeIdx );
                     }
                 }
             }
@@ -228,14 +228,11 @@ namespace Battle
 
         const BattleNodeIndex nodeIdx = { position.GetHead()->GetIndex(), position.GetTail() ? position.GetTail()->GetIndex() : -1 };
 
-        const auto iter = _cache.find( nodeIdx );
-        if ( iter == _cache.end() ) {
+        if ( !isNodeReached( nodeIdx ) ) {
             return false;
         }
 
-        const auto & [index, node] = *iter;
-
-        return ( index == _pathStart || node._from != BattleNodeIndex{ -1, -1 } ) && ( !isOnCurrentTurn || node._cost <= _speed );
+        return !isOnCurrentTurn || getNode( nodeIdx )._cost <= _speed;
     }
 
     uint32_t BattlePathfinder::getCost( const Unit & unit, const Position & position )
@@ -245,15 +242,9 @@ namespace Battle
         reEvaluateIfNeeded( unit );
 
         const BattleNodeIndex nodeIdx = { position.GetHead()->GetIndex(), position.GetTail() ? position.GetTail()->GetIndex() : -1 };
+        assert( isNodeReached( nodeIdx ) );
 
-        const auto iter = _cache.find( nodeIdx );
-        assert( iter != _cache.end() );
-
-        const auto & [index, node] = *iter;
-        // MSVC 2017 fails to properly expand the assert() macro without additional parentheses
-        assert( ( index == _pathStart || node._from != BattleNodeIndex{ -1, -1 } ) );
-
-        return node._cost;
+        return getNode( nodeIdx )._cost;
     }
 
     uint32_t BattlePathfinder::getDistance( const Unit & unit, const Position & position )
@@ -263,38 +254,33 @@ namespace Battle
         reEvaluateIfNeeded( unit );
 
         const BattleNodeIndex nodeIdx = { position.GetHead()->GetIndex(), position.GetTail() ? position.GetTail()->GetIndex() : -1 };
+        assert( isNodeReached( nodeIdx ) );
 
-        const auto iter = _cache.find( nodeIdx );
-        assert( iter != _cache.end() );
-
-        const auto & [index, node] = *iter;
-        // MSVC 2017 fails to properly expand the assert() macro without additional parentheses
-        assert( ( index == _pathStart || node._from != BattleNodeIndex{ -1, -1 } ) );
-
-        return node._distance;
+        return getNode( nodeIdx )._distance;
     }
 
     Indexes BattlePathfinder::getAllAvailableMoves( const Unit & unit )
     {
         reEvaluateIfNeeded( unit );
 
-        std::set<int32_t> boardIndexes;
+        Indexes result;
+        result.reserve( Board::sizeInCells );
 
-        for ( const auto & [index, node] : _cache ) {
-            if ( index == _pathStart || node._from == BattleNodeIndex{ -1, -1 } || node._cost > _speed ) {
+        // Nodes are ordered by the index of the head cell, so the resulting indexes are sorted and only nodes of the same cell can be adjacent duplicates
+        for ( size_t nodeIdx = 0; nodeIdx < _nodes.size(); ++nodeIdx ) {
+            const BattleNode & node = _nodes[nodeIdx];
+            if ( node._from == BattleNodeIndex{ -1, -1 } || node._cost > _speed ) {
                 continue;
             }
 
-            assert( index.first != -1 );
+            const int32_t headCellIdx = static_cast<int32_t>( nodeIdx / 2 );
+            if ( !result.empty() && result.back() == headCellIdx ) {
+                continue;
+            }
 
-            boardIndexes.insert( index.first );
+            result.push_back( headCellIdx );
         }
 
-        Indexes result;
-
-        result.reserve( boardIndexes.size() );
-        result.assign( boardIndexes.begin(), boardIndexes.end() );
-
         return result;
     }
 
@@ -310,13 +296,14 @@ namespace Battle
         BattleNodeIndex lastReachableNodeIdx{ -1, -1 };
         BattleNodeIndex nodeIdx = { position.GetHead()->GetIndex(), position.GetTail() ? position.GetTail()->GetIndex() : -1 };
 
-        for ( auto iter = _cache.find( nodeIdx ); iter != _cache.end(); iter = _cache.find( nodeIdx ) ) {
-            const auto & [index, node] = *iter;
-
+        while ( isNodeReached( nodeIdx ) ) {
+            const BattleNodeIndex index = nodeIdx;
             if ( index == _pathStart ) {
                 break;
             }
 
+            const BattleNode & node = getNode( index );
+
             // MSVC 2017 fails to properly expand the assert() macro without additional parentheses
             assert( ( node._from != BattleNodeIndex{ -1, -1 } ) );
 
@@ -365,13 +352,14 @@ namespace Battle
 
         BattleNodeIndex nodeIdx = { position.GetHead()->GetIndex(), position.GetTail() ? position.GetTail()->GetIndex() : -1 };
 
-        for ( auto iter = _cache.find( nodeIdx ); iter != _cache.end(); iter = _cache.find( nodeIdx ) ) {
-            const auto & [index, node] = *iter;
-
+        while ( isNodeReached( nodeIdx ) ) {
+            const BattleNodeIndex index = nodeIdx;
             if ( index == _pathStart ) {
                 break;
             }
 
+            const BattleNode & node = getNode( index );
+
             // MSVC 2017 fails to properly expand the assert() macro without additional parentheses
             assert( ( node._from != BattleNodeIndex{ -1, -1 } ) );
 
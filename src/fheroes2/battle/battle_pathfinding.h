@@ -1,6 +1,6 @@
 /***************************************************************************
  *   fheroes2: https://github.com/ihhub/fheroes2                           *
- *   Copyright (C) 2020 - 2025                                             *
+ *   Copyright (C) 2020 - 2026                                             *
  *                                                                         *
  *   This program is free software; you can redistribute it and/or modify  *
  *   it under the terms of the GNU General Public License as published by  *
@@ -21,10 +21,11 @@
 #pragma once
 
 #include <array>
+#include <cassert>
 #include <cstddef>
 #include <cstdint>
-#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "battle_board.h"
 #include "color.h"
@@ -36,19 +37,6 @@ namespace Battle
 
     using BattleNodeIndex = std::pair<int32_t, int32_t>;
 
-    struct BattleNodeIndexHash final
-    {
-        std::size_t operator()( const BattleNodeIndex & index ) const noexcept
-        {
-            const uint64_t f = index.first;
-            const uint64_t s = index.second;
-
-            std::hash<uint64_t> hasher;
-
-            return hasher( ( f << 32 ) + s );
-        }
-    };
-
     struct BattleNode final
     {
         BattleNodeIndex _from{ -1, -1 };
@@ -109,7 +97,27 @@ namespace Battle
         // Rebuilds the graph of available positions for the given unit if necessary (if it is not already cached)
         void reEvaluateIfNeeded( const Unit & unit );
 
-        std::unordered_map<BattleNodeIndex, BattleNode, BattleNodeIndexHash> _cache;
+        // Returns the node corresponding to the given position. The head cell of the position determines the node, as well as the location
+        // of the tail cell for wide units: a wide unit can only occupy the cell to the left or to the right of its head cell as its tail.
+        BattleNode & getNode( const BattleNodeIndex & index )
+        {
+            const auto [headCellIdx, tailCellIdx] = index;
+            assert( Board::isValidIndex( headCellIdx ) );
+            assert( tailCellIdx == -1 || tailCellIdx == headCellIdx - 1 || tailCellIdx == headCellIdx + 1 );
+
+            return _nodes[static_cast<size_t>( headCellIdx ) * 2 + ( tailCellIdx > headCellIdx ? 1 : 0 )];
+        }
+
+        // Returns true if the node corresponding to the given position has been reached while building the graph
+        bool isNodeReached( const BattleNodeIndex & index )
+        {
+            return index == _pathStart || getNode( index )._from != BattleNodeIndex{ -1, -1 };
+        }
+
+        // Nodes of the graph for every possible position of the unit. Narrow units use only the first node for every cell.
+        std::array<BattleNode, Board::sizeInCells * 2> _nodes;
+        // The queue of nodes to explore while building the graph. It is kept between re-evaluations to avoid memory allocations.
+        std::vector<BattleNodeIndex> _nodesToExplore;
 
         // Parameters of the unit for which the current cache is created
         BattleNodeIndex _pathStart{ -1, -1 };
@@ -21,16 +21,147 @@
 #include "history_manager.h"
 
 #include <cassert>
+#include <cstddef>
 #include <cstdint>
 #include <map>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
 
 #include "map_format_helper.h"
 #include "map_format_info.h"
-#include "serialize.h"
 #include "world_object_uid.h"
 
 namespace
 {
+    // Changes of a single metadata map. Only added, removed or modified entries are stored.
+    template <typename T>
+    class MetadataDelta
+    {
+    public:
+        void capture( std::map<uint32_t, T> && before, const std::map<uint32_t, T> & after )
+        {
+            _changes.clear();
+
+            // Both maps are sorted by UID so they can be compared in a single pass.
+            auto beforeIter = before.begin();
+            auto afterIter = after.begin();
+
+            while ( beforeIter != before.end() || afterIter != after.end() ) {
+                if ( afterIter == after.end() || ( beforeIter != before.end() && beforeIter->first < afterIter->first ) ) {
+                    // The entry has been removed.
+                    _changes.push_back( { beforeIter->first, std::move( beforeIter->second ), std::nullopt } );
+                    ++beforeIter;
+                }
+                else if ( beforeIter == before.end() || afterIter->first < beforeIter->first ) {
+                    // The entry has been added.
+                    _changes.push_back( { afterIter->first, std::nullopt, afterIter->second } );
+                    ++afterIter;
+                }
+                else {
+                    if ( beforeIter->second != afterIter->second ) {
+                        _changes.push_back( { beforeIter->first, std::move( beforeIter->second ), afterIter->second } );
+                    }
+
+                    ++beforeIter;
+                    ++afterIter;
+                }
+            }
+
+            _changes.shrink_to_fit();
+        }
+
+        void apply( std::map<uint32_t, T> & metadata, const bool isUndo ) const
+        {
+            for ( const Change & change : _changes ) {
+                const std::optional<T> & value = isUndo ? change.before : change.after;
+                if ( value ) {
+                    metadata.insert_or_assign( change.uid, *value );
+                }
+                else {
+                    metadata.erase( change.uid );
+                }
+            }
+        }
+
+    private:
+        struct Change
+        {
+            uint32_t uid{ 0 };
+            std::optional<T> before;
+            std::optional<T> after;
+        };
+
+        std::vector<Change> _changes;
+    };
+
+    // Changes of map tiles. Only modified tiles are stored unless the map size has been changed.
+    class TileDelta
+    {
+    public:
+        void capture( std::vector<Maps::Map_Format::TileInfo> && before, const std::vector<Maps::Map_Format::TileInfo> & after )
+        {
+            _changes.clear();
+            _tilesBefore.clear();
+            _tilesAfter.clear();
+
+            if ( before.size() != after.size() ) {
+                // This is a very rare case so it is fine to store both copies of tiles.
+                _tilesBefore = std::move( before );
+                _tilesAfter = after;
+                return;
+            }
+
+            for ( size_t i = 0; i < before.size(); ++i ) {
+                if ( before[i] != after[i] ) {
+                    _changes.push_back( { i, std::move( before[i] ), after[i] } );
+                }
+            }
+
+            _changes.shrink_to_fit();
+        }
+
+        void apply( std::vector<Maps::Map_Format::TileInfo> & tiles, const bool isUndo ) const
+        {
+            const std::vector<Maps::Map_Format::TileInfo> & allTiles = isUndo ? _tilesBefore : _tilesAfter;
+            if ( !allTiles.empty() ) {
+                tiles = allTiles;
+                return;
+            }
+
+            for ( const Change & change : _changes ) {
+                assert( change.index < tiles.size() );
+
+                tiles[change.index] = isUndo ? change.before : change.after;
+            }
+        }
+
+    private:
+        struct Change
+        {
+            size_t index{ 0 };
+            Maps::Map_Format::TileInfo before;
+            Maps::Map_Format::TileInfo after;
+        };
+
+        std::vector<Change> _changes;
+
+        std::vector<Maps::Map_Format::TileInfo> _tilesBefore;
+        std::vector<Maps::Map_Format::TileInfo> _tilesAfter;
+    };
+
+    // Copies all map properties except tiles and object metadata. These properties are small so there is no need to track changes in them.
+    void copyMapProperties( const Maps::Map_Format::MapFormat & from, Maps::Map_Format::MapFormat & to )
+    {
+        static_cast<Maps::Map_Format::BaseMapFormat &>( to ) = from;
+
+        to.additionalInfo = from.additionalInfo;
+        to.dailyEvents = from.dailyEvents;
+        to.rumors = from.rumors;
+        to.translationInfo = from.translationInfo;
+    }
+
     class BaseMapAction : public fheroes2::Action
     {
     public:
@@ -45,28 +176,50 @@ namespace
         virtual bool prepare() = 0;
     };
 
-    // This class holds 2 copies of MapFormat objects in a compressed format:
-    // - one copy before the action
-    // - one copy after the action
+    // This class holds only the changes made by the action:
+    // - tiles that differ before and after the action
+    // - metadata entries that have been added, removed or modified
+    // - all other map properties before and after the action
+    // A full copy of the map is kept only until the action is prepared.
     class GenericMapAction final : public BaseMapAction
     {
     public:
         explicit GenericMapAction( Maps::Map_Format::MapFormat & mapFormat )
             : _mapFormat( mapFormat )
+            , _mapFormatBefore( std::make_unique<Maps::Map_Format::MapFormat>( mapFormat ) )
             , _latestObjectUIDBefore( Maps::getLastObjectUID() )
         {
-            if ( !Maps::Map_Format::saveMap( _beforeMapFormat, _mapFormat ) ) {
-                assert( 0 );
-            }
+            // Do nothing.
         }
 
         bool prepare() override
         {
-            if ( !Maps::Map_Format::saveMap( _afterMapFormat, _mapFormat ) ) {
+            if ( !_mapFormatBefore ) {
+                // Did you call this method twice?
                 assert( 0 );
                 return false;
             }
 
+            Maps::Map_Format::MapFormat & before = *_mapFormatBefore;
+
+            _tiles.capture( std::move( before.tiles ), _mapFormat.tiles );
+
+            _castleMetadata.capture( std::move( before.castleMetadata ), _mapFormat.castleMetadata );
+            _heroMetadata.capture( std::move( before.heroMetadata ), _mapFormat.heroMetadata );
+            _sphinxMetadata.capture( std::move( before.sphinxMetadata ), _mapFormat.sphinxMetadata );
+            _signMetadata.capture( std::move( before.signMetadata ), _mapFormat.signMetadata );
+            _adventureMapEventMetadata.capture( std::move( before.adventureMapEventMetadata ), _mapFormat.adventureMapEventMetadata );
+            _selectionObjectMetadata.capture( std::move( before.selectionObjectMetadata ), _mapFormat.selectionObjectMetadata );
+            _capturableObjectsMetadata.capture( std::move( before.capturableObjectsMetadata ), _mapFormat.capturableObjectsMetadata );
+            _monsterMetadata.capture( std::move( before.monsterMetadata ), _mapFormat.monsterMetadata );
+            _artifactMetadata.capture( std::move( before.artifactMetadata ), _mapFormat.artifactMetadata );
+            _resourceMetadata.capture( std::move( before.resourceMetadata ), _mapFormat.resourceMetadata );
+
+            copyMapProperties( before, _propertiesBefore );
+            copyMapProperties( _mapFormat, _propertiesAfter );
+
+            _mapFormatBefore.reset();
+
             _latestObjectUIDAfter = Maps::getLastObjectUID();
 
             return true;
@@ -74,52 +227,81 @@ namespace
 
         bool redo() override
         {
-            if ( !Maps::Map_Format::loadMap( _afterMapFormat, _mapFormat ) ) {
-                assert( 0 );
-                return false;
-            }
-
-            _afterMapFormat.seek( 0 );
-
-            if ( !Maps::readMapInEditor( _mapFormat ) ) {
-                // If this assertion blows up then something is really wrong with the Editor.
-                assert( 0 );
-                return false;
-            }
+            assert( !_mapFormatBefore );
 
-            Maps::setLastObjectUID( _latestObjectUIDAfter );
+            _apply( false );
 
-            return true;
+            return _updateEditorMap( _latestObjectUIDAfter );
         }
 
         bool undo() override
         {
-            if ( !Maps::Map_Format::loadMap( _beforeMapFormat, _mapFormat ) ) {
-                assert( 0 );
-                return false;
+            if ( _mapFormatBefore ) {
+                // The action has not been prepared yet so the whole map copy is still available.
+                _mapFormat = *_mapFormatBefore;
             }
+            else {
+                _apply( true );
+            }
+
+            return _updateEditorMap( _latestObjectUIDBefore );
+        }
+
+    private:
+        Maps::Map_Format::MapFormat & _mapFormat;
+
+        std::unique_ptr<Maps::Map_Format::MapFormat> _mapFormatBefore;
+
+        TileDelta _tiles;
+
+        MetadataDelta<Maps::Map_Format::CastleMetadata> _castleMetadata;
+        MetadataDelta<Maps::Map_Format::HeroMetadata> _heroMetadata;
+        MetadataDelta<Maps::Map_Format::SphinxMetadata> _sphinxMetadata;
+        MetadataDelta<Maps::Map_Format::SignMetadata> _signMetadata;
+        MetadataDelta<Maps::Map_Format::AdventureMapEventMetadata> _adventureMapEventMetadata;
+        MetadataDelta<Maps::Map_Format::SelectionObjectMetadata> _selectionObjectMetadata;
+        MetadataDelta<Maps::Map_Format::CapturableObjectMetadata> _capturableObjectsMetadata;
+        MetadataDelta<Maps::Map_Format::MonsterMetadata> _monsterMetadata;
+        MetadataDelta<Maps::Map_Format::ArtifactMetadata> _artifactMetadata;
+        MetadataDelta<Maps::Map_Format::ResourceMetadata> _resourceMetadata;
 
-            _beforeMapFormat.seek( 0 );
+        // Only properties which are not stored in deltas above are set in these objects.
+        Maps::Map_Format::MapFormat _propertiesBefore;
+        Maps::Map_Format::MapFormat _propertiesAfter;
 
+        const uint32_t _latestObjectUIDBefore{ 0 };
+        uint32_t _latestObjectUIDAfter{ 0 };
+
+        void _apply( const bool isUndo )
+        {
+            _tiles.apply( _mapFormat.tiles, isUndo );
+
+            _castleMetadata.apply( _mapFormat.castleMetadata, isUndo );
+            _heroMetadata.apply( _mapFormat.heroMetadata, isUndo );
+            _sphinxMetadata.apply( _mapFormat.sphinxMetadata, isUndo );
+            _signMetadata.apply( _mapFormat.signMetadata, isUndo );
+            _adventureMapEventMetadata.apply( _mapFormat.adventureMapEventMetadata, isUndo );
+            _selectionObjectMetadata.apply( _mapFormat.selectionObjectMetadata, isUndo );
+            _capturableObjectsMetadata.apply( _mapFormat.capturableObjectsMetadata, isUndo );
+            _monsterMetadata.apply( _mapFormat.monsterMetadata, isUndo );
+            _artifactMetadata.apply( _mapFormat.artifactMetadata, isUndo );
+            _resourceMetadata.apply( _mapFormat.resourceMetadata, isUndo );
+
+            copyMapProperties( isUndo ? _propertiesBefore : _propertiesAfter, _mapFormat );
+        }
+
+        bool _updateEditorMap( const uint32_t latestObjectUID ) const
+        {
             if ( !Maps::readMapInEditor( _mapFormat ) ) {
                 // If this assertion blows up then something is really wrong with the Editor.
                 assert( 0 );
                 return false;
             }
 
-            Maps::setLastObjectUID( _latestObjectUIDBefore );
+            Maps::setLastObjectUID( latestObjectUID );
 
             return true;
         }
-
-    private:
-        Maps::Map_Format::MapFormat & _mapFormat;
-
-        RWStreamBuf _beforeMapFormat;
-        RWStreamBuf _afterMapFormat;
-
-        const uint32_t _latestObjectUIDBefore{ 0 };
-        uint32_t _latestObjectUIDAfter{ 0 };
     };
 
     template <typename T>
@@ -135,27 +317,46 @@ namespace
 
         bool prepare() override
         {
-            _afterMetadata = _metadata;
+            if ( !_beforeMetadata ) {
+                // Did you call this method twice?
+                assert( 0 );
+                return false;
+            }
+
+            _delta.capture( std::move( *_beforeMetadata ), _metadata );
+            _beforeMetadata.reset();
+
             return true;
         }
 
         bool redo() override
         {
-            _metadata = _afterMetadata;
+            assert( !_beforeMetadata );
+
+            _delta.apply( _metadata, false );
             return true;
         }
 
         bool undo() override
         {
-            _metadata = _beforeMetadata;
+            if ( _beforeMetadata ) {
+                // The action has not been prepared yet.
+                _metadata = *_beforeMetadata;
+            }
+            else {
+                _delta.apply( _metadata, true );
+            }
+
             return true;
         }
 
     private:
         std::map<uint32_t, T> & _metadata;
 
-        const std::map<uint32_t, T> _beforeMetadata;
-        std::map<uint32_t, T> _afterMetadata;
+        // A full copy of metadata is kept only until the action is prepared.
+        std::optional<std::map<uint32_t, T>> _beforeMetadata;
+
+        MetadataDelta<T> _delta;
     };
 }
 
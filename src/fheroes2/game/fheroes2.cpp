@@ -65,6 +65,8 @@
 #include "embedded_image.h"
 #include "exception.h"
 #include "game.h"
+#include "game_auto_playtest.h"
+#include "game_benchmark.h"
 #include "game_logo.h"
 #include "game_video.h"
 #include "game_video_type.h"
@@ -161,11 +163,17 @@ namespace
     class DisplayInitializer final
     {
     public:
-        DisplayInitializer()
+        explicit DisplayInitializer( const bool isHeadless )
         {
-            const Settings & conf = Settings::Get();
-
             fheroes2::Display & display = fheroes2::Display::instance();
+
+            if ( isHeadless ) {
+                // Nothing is going to be shown so there is no need for renderers, color cycling and cursor updates.
+                display.setResolution( { fheroes2::Display::DEFAULT_WIDTH, fheroes2::Display::DEFAULT_HEIGHT } );
+                return;
+            }
+
+            const Settings & conf = Settings::Get();
             fheroes2::ResolutionInfo bestResolution{ conf.currentResolutionInfo() };
 
             if ( conf.isFirstGameRun() && System::isHandheldDevice() ) {
@@ -231,7 +239,7 @@ namespace
     class DataInitializer final
     {
     public:
-        DataInitializer()
+        explicit DataInitializer( const bool isHeadless )
         {
             const fheroes2::ScreenPaletteRestorer screenRestorer;
 
@@ -244,7 +252,10 @@ namespace
                 fheroes2::AGG::GetICN( ICN::FONT, 0 );
             }
             catch ( ... ) {
-                displayMissingResourceWindow();
+                // There is nobody to read the message in headless mode.
+                if ( !isHeadless ) {
+                    displayMissingResourceWindow();
+                }
 
                 throw;
             }
@@ -290,10 +301,18 @@ int main( int argc, char ** argv )
     assert( argc == __argc );
 
     argv = __argv;
-#else
-    (void)argc;
 #endif
 
+    fheroes2::HeadlessPlaytestParameters headlessPlaytestParameters;
+    fheroes2::BenchmarkParameters benchmarkParameters;
+    const bool isHeadlessPlaytest = fheroes2::parseHeadlessPlaytestArguments( argc, argv, headlessPlaytestParameters );
+    const bool isBenchmark = !isHeadlessPlaytest && fheroes2::parseBenchmarkArguments( argc, argv, benchmarkParameters );
+    const bool isHeadless = isHeadlessPlaytest || isBenchmark;
+    if ( isHeadless ) {
+        // This must be done before anything accesses the display.
+        fheroes2::Display::enableHeadlessMode();
+    }
+
     try {
         const fheroes2::HardwareInitializer hardwareInitializer;
         Logging::InitLog();
@@ -307,19 +326,23 @@ int main( int argc, char ** argv )
         InitDataDir();
         ReadConfigs();
 
-        std::set<fheroes2::SystemInitializationComponent> coreComponents{ fheroes2::SystemInitializationComponent::Audio,
-                                                                          fheroes2::SystemInitializationComponent::Video };
+        std::set<fheroes2::SystemInitializationComponent> coreComponents;
+
+        if ( !isHeadless ) {
+            coreComponents.emplace( fheroes2::SystemInitializationComponent::Audio );
+            coreComponents.emplace( fheroes2::SystemInitializationComponent::Video );
 
 #if defined( TARGET_PS_VITA ) || defined( TARGET_NINTENDO_SWITCH )
-        coreComponents.emplace( fheroes2::SystemInitializationComponent::GameController );
+            coreComponents.emplace( fheroes2::SystemInitializationComponent::GameController );
 #endif
+        }
 
         const fheroes2::CoreInitializer coreInitializer( coreComponents );
 
         DEBUG_LOG( DBG_GAME, DBG_INFO, conf.String() )
 
-        const DisplayInitializer displayInitializer;
-        const DataInitializer dataInitializer;
+        const DisplayInitializer displayInitializer( isHeadless );
+        const DataInitializer dataInitializer( isHeadless );
 
         ListFiles midiSoundFonts;
         {
@@ -365,6 +388,14 @@ int main( int argc, char ** argv )
         // Initialize game data.
         Game::Init();
 
+        if ( isHeadlessPlaytest ) {
+            return fheroes2::runHeadlessAutoPlaytest( headlessPlaytestParameters ) ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+
+        if ( isBenchmark ) {
+            return fheroes2::runBenchmark( benchmarkParameters ) ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+
         if ( conf.isShowIntro() ) {
             fheroes2::showTeamInfo();
             for ( const char * logo : { "NWCLOGO.SMK", "CYLOGO.SMK", "H2XINTRO.SMK" } ) {
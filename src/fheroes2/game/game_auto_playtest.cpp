@@ -22,9 +22,14 @@
 
 #include <cassert>
 #include <cstddef>
+#include <cstdlib>
+#include <fstream>
 #include <map>
 #include <memory>
+#include <ostream>
+#include <sstream>
 #include <string>
+#include <string_view>
 
 #include "agg_image.h"
 #include "audio.h"
@@ -38,29 +43,28 @@
 #include "icn.h"
 #include "image.h"
 #include "localevent.h"
+#include "logging.h"
 #include "maps_fileinfo.h"
 #include "math_base.h"
 #include "mus.h"
 #include "pal.h"
 #include "players.h"
+#include "rand.h"
 #include "screen.h"
 #include "settings.h"
+#include "system.h"
+#include "timing.h"
 #include "tools.h"
 #include "translations.h"
 #include "ui_button.h"
 #include "ui_dialog.h"
+#include "ui_language.h"
 #include "ui_slider.h"
 #include "ui_text.h"
 #include "ui_tool.h"
 #include "ui_window.h"
 #include "world.h"
 
-#if defined( WITH_DEBUG )
-#include <ostream>
-
-#include "logging.h"
-#endif
-
 namespace
 {
     constexpr int32_t sliderWidth{ 150 };
@@ -346,6 +350,160 @@ namespace
 
         return { offsetX, offsetY, cell.width(), cell.height() };
     }
+
+    // Color names are not translated to keep results comparable between runs with different game languages.
+    const char * getColorId( const PlayerColor color )
+    {
+        switch ( color ) {
+        case PlayerColor::BLUE:
+            return "blue";
+        case PlayerColor::GREEN:
+            return "green";
+        case PlayerColor::RED:
+            return "red";
+        case PlayerColor::YELLOW:
+            return "yellow";
+        case PlayerColor::ORANGE:
+            return "orange";
+        case PlayerColor::PURPLE:
+            return "purple";
+        default:
+            // Did you add a new color?
+            assert( 0 );
+            break;
+        }
+
+        return "none";
+    }
+
+    const char * getPlayerStateId( const fheroes2::AutoPlaytest::PlayerState state )
+    {
+        switch ( state ) {
+        case fheroes2::AutoPlaytest::PlayerState::WINNER:
+            return "winner";
+        case fheroes2::AutoPlaytest::PlayerState::LOSER:
+            return "loser";
+        case fheroes2::AutoPlaytest::PlayerState::TIME_LIMIT:
+            return "time_limit";
+        case fheroes2::AutoPlaytest::PlayerState::INTERRUPTED:
+            return "interrupted";
+        default:
+            // Did you add a new state?
+            assert( 0 );
+            break;
+        }
+
+        return "unknown";
+    }
+
+    std::string escapeJsonString( const std::string_view value )
+    {
+        std::string result;
+        result.reserve( value.size() );
+
+        for ( const char symbol : value ) {
+            switch ( symbol ) {
+            case '"':
+                result += "\\\"";
+                break;
+            case '\\':
+                result += "\\\\";
+                break;
+            case '\n':
+                result += "\\n";
+                break;
+            case '\t':
+                result += "\\t";
+                break;
+            default:
+                result += symbol;
+                break;
+            }
+        }
+
+        return result;
+    }
+
+    bool writePlaythroughResults( const fheroes2::HeadlessPlaytestParameters & parameters, const uint32_t seed, const std::vector<fheroes2::AutoPlaytest::PlayerInfo> & result,
+                                  const double wallTimeS )
+    {
+        const uint32_t lastDay = world.CountDay();
+
+        // Every alive player makes one turn per day so the total number of turns is the sum of days every player was in the game.
+        uint32_t playerTurns{ 0 };
+        bool isTimeLimitReached{ false };
+
+        std::ostringstream os;
+        os << "{\n";
+        os << "  \"map\": \"" << escapeJsonString( parameters.mapPath ) << "\",\n";
+        os << "  \"seed\": " << seed << ",\n";
+        os << "  \"players\": [";
+
+        std::string winners;
+
+        for ( size_t i = 0; i < result.size(); ++i ) {
+            const fheroes2::AutoPlaytest::PlayerInfo & info = result[i];
+
+            uint32_t dayOfState = info.dayOfState;
+
+            switch ( info.state ) {
+            case fheroes2::AutoPlaytest::PlayerState::WINNER:
+                dayOfState = lastDay;
+
+                if ( !winners.empty() ) {
+                    winners += ", ";
+                }
+                winners += '"';
+                winners += getColorId( info.color );
+                winners += '"';
+                break;
+            case fheroes2::AutoPlaytest::PlayerState::TIME_LIMIT:
+                isTimeLimitReached = true;
+                break;
+            default:
+                break;
+            }
+
+            playerTurns += dayOfState;
+
+            os << ( i == 0 ? "\n" : ",\n" );
+            os << "    { \"color\": \"" << getColorId( info.color ) << "\", \"state\": \"" << getPlayerStateId( info.state ) << "\", \"day\": " << dayOfState
+               << " }";
+        }
+
+        os << "\n  ],\n";
+        os << "  \"winners\": [" << winners << "],\n";
+        os << "  \"time_limit_reached\": " << ( isTimeLimitReached ? "true" : "false" ) << ",\n";
+        os << "  \"days\": " << ( isTimeLimitReached ? static_cast<uint32_t>( parameters.maxDays ) : lastDay ) << ",\n";
+        os << "  \"player_turns\": " << playerTurns << ",\n";
+        os << "  \"wall_time_s\": " << wallTimeS << ",\n";
+        os << "  \"turns_per_s\": " << ( wallTimeS > 0 ? playerTurns / wallTimeS : 0.0 ) << "\n";
+        os << "}\n";
+
+        const std::string filePath = System::concatPath( parameters.outputDirectory, "playthrough_" + std::to_string( seed ) + ".json" );
+
+        std::ofstream file( filePath, std::ios::out | std::ios::trunc );
+        if ( !file ) {
+            ERROR_LOG( "Failed to open file '" << filePath << "' to write auto playtest results." )
+            return false;
+        }
+
+        file << os.str();
+
+        return file.good();
+    }
+
+    bool parseUnsignedValue( const char * input, uint32_t & value )
+    {
+        char * end = nullptr;
+        const unsigned long result = std::strtoul( input, &end, 10 );
+        if ( end == input || *end != '\0' ) {
+            return false;
+        }
+
+        value = static_cast<uint32_t>( result );
+        return true;
+    }
 }
 
 namespace fheroes2
@@ -558,4 +716,96 @@ namespace fheroes2
 
         autoPlaytest.interrupt( world.CountDay() );
     }
+
+    bool parseHeadlessPlaytestArguments( const int argc, const char * const * argv, HeadlessPlaytestParameters & parameters )
+    {
+        if ( argc < 3 || std::string_view( argv[1] ) != "--autoplaytest" ) {
+            return false;
+        }
+
+        parameters = {};
+        parameters.mapPath = argv[2];
+
+        for ( int i = 3; i + 1 < argc; i += 2 ) {
+            const std::string_view option( argv[i] );
+            const char * value = argv[i + 1];
+
+            uint32_t number{ 0 };
+
+            if ( option == "--output" ) {
+                parameters.outputDirectory = value;
+            }
+            else if ( option == "--seed" && parseUnsignedValue( value, number ) ) {
+                parameters.seed = number;
+            }
+            else if ( option == "--playthroughs" && parseUnsignedValue( value, number ) ) {
+                parameters.playthroughCount = static_cast<int32_t>( std::max( number, 1U ) );
+            }
+            else if ( option == "--days" && parseUnsignedValue( value, number ) ) {
+                parameters.maxDays = static_cast<int32_t>( std::clamp( number, 1U, static_cast<uint32_t>( AutoPlaytest::dayLimit ) ) );
+            }
+            else {
+                ERROR_LOG( "Invalid auto playtest command line option '" << option << "' with value '" << value << "'." )
+            }
+        }
+
+        return true;
+    }
+
+    bool runHeadlessAutoPlaytest( const HeadlessPlaytestParameters & parameters )
+    {
+        Settings & conf = Settings::Get();
+
+        Maps::FileInfo mapInfo;
+        if ( !mapInfo.readResurrectionMap( parameters.mapPath, false, getCurrentLanguage() ) ) {
+            ERROR_LOG( "Failed to read map '" << parameters.mapPath << "' for auto playtest." )
+            return false;
+        }
+
+        conf.setCurrentMapInfo( std::move( mapInfo ) );
+
+        if ( !System::IsDirectory( parameters.outputDirectory ) && !System::MakeDirectory( parameters.outputDirectory ) ) {
+            ERROR_LOG( "Failed to create directory '" << parameters.outputDirectory << "' for auto playtest results." )
+            return false;
+        }
+
+        auto & autoPlaytest = AutoPlaytest::instance();
+        autoPlaytest.enableAnimation( false );
+        autoPlaytest.enableSounds( false );
+        autoPlaytest.setMaxDaysInPlaythrough( parameters.maxDays );
+
+        // The configuration file is never saved in this mode so there is no need to restore the original AI speed.
+        conf.SetAIMoveSpeed( 0 );
+        Game::UpdateGameSpeed();
+
+        for ( int32_t playthroughId = 0; playthroughId < parameters.playthroughCount; ++playthroughId ) {
+            const uint32_t seed = parameters.seed + static_cast<uint32_t>( playthroughId );
+
+            // Player races, the map seed and all AI decisions are derived from this generator, so every playthrough is reproducible by its seed.
+            Rand::CurrentThreadRandomDevice() = Rand::PCG32( seed );
+
+            if ( !prepareMap() ) {
+                ERROR_LOG( "Failed to prepare map '" << parameters.mapPath << "' for auto playtest." )
+                return false;
+            }
+
+            autoPlaytest.reset( conf.GetPlayers().GetColors() );
+
+            conf.SetGameType( Game::TYPE_AUTO_PLAYTEST );
+
+            const Time timer;
+
+            Game::StartGame();
+
+            const double wallTimeS = timer.getS();
+
+            if ( !writePlaythroughResults( parameters, seed, autoPlaytest.getResults().back(), wallTimeS ) ) {
+                return false;
+            }
+
+            COUT( "Playthrough with seed " << seed << " finished on day " << world.CountDay() << " in " << wallTimeS << " seconds." )
+        }
+
+        return true;
+    }
 }
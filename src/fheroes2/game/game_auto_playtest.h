@@ -23,6 +23,7 @@
 #include <algorithm>
 #include <cassert>
 #include <cstdint>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -200,7 +201,31 @@ namespace fheroes2
         bool _playEnvironmentSounds{ true };
     };
 
+    // Parameters of an auto playtest run without any UI, audio or user input. Such playtests are started from the command line:
+    // fheroes2 --autoplaytest <map.fh2m> [--seed <value>] [--playthroughs <count>] [--days <count>] [--output <directory>]
+    struct HeadlessPlaytestParameters final
+    {
+        std::string mapPath;
+
+        // Every playthrough writes its results into a separate JSON file within this directory.
+        std::string outputDirectory{ "." };
+
+        // Playthroughs are run one after another using consecutive seeds starting from this value.
+        uint32_t seed{ 0 };
+
+        int32_t playthroughCount{ 1 };
+
+        int32_t maxDays{ 365 };
+    };
+
     bool openMapAutoPlayTest();
 
     void interruptAutoPlaytest();
+
+    // Returns true if the command line requests a headless auto playtest. The parameters are filled only in this case.
+    bool parseHeadlessPlaytestArguments( const int argc, const char * const * argv, HeadlessPlaytestParameters & parameters );
+
+    // Runs a headless auto playtest. The display must be switched to headless mode before calling this function.
+    // Returns false if the map cannot be loaded or the results cannot be written.
+    bool runHeadlessAutoPlaytest( const HeadlessPlaytestParameters & parameters );
 }
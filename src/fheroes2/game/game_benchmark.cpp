@@ -0,0 +1,424 @@
+/***************************************************************************
+ *   fheroes2: https://github.com/ihhub/fheroes2                           *
+ *   Copyright (C) 2026                                                    *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include "game_benchmark.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "ai_battle_estimator.h"
+#include "army.h"
+#include "battle_arena.h"
+#include "battle_army.h"
+#include "battle_troop.h"
+#include "color.h"
+#include "game_io.h"
+#include "heroes.h"
+#include "kingdom.h"
+#include "logging.h"
+#include "maps_fileinfo.h"
+#include "maps_tiles.h"
+#include "mp2.h"
+#include "players.h"
+#include "rand.h"
+#include "settings.h"
+#include "system.h"
+#include "timing.h"
+#include "tools.h"
+#include "ui_language.h"
+#include "world.h"
+#include "world_pathfinding.h"
+
+namespace
+{
+    bool loadMap( const std::string & mapPath )
+    {
+        Settings & conf = Settings::Get();
+
+        Maps::FileInfo mapInfo;
+
+        const std::string_view resurrectionMapExtension{ ".fh2m" };
+        const std::string lowerCasePath = StringLower( mapPath );
+
+        if ( lowerCasePath.size() > resurrectionMapExtension.size()
+             && std::string_view( lowerCasePath ).substr( lowerCasePath.size() - resurrectionMapExtension.size() ) == resurrectionMapExtension ) {
+            if ( !mapInfo.readResurrectionMap( mapPath, false, fheroes2::getCurrentLanguage() ) ) {
+                return false;
+            }
+        }
+        else if ( !mapInfo.readMP2Map( mapPath, false ) ) {
+            return false;
+        }
+
+        conf.setCurrentMapInfo( std::move( mapInfo ) );
+
+        // Map objects and player races depend on the random generator, so every run of the benchmark has to start from the same state.
+        Rand::CurrentThreadRandomDevice() = Rand::PCG32( 0 );
+
+        Players & players = conf.GetPlayers();
+        players.Init( conf.getCurrentMapInfo() );
+        players.SetStartGame();
+
+        const Maps::FileInfo & currentMapInfo = conf.getCurrentMapInfo();
+        if ( currentMapInfo.version == GameVersion::RESURRECTION ) {
+            return world.loadResurrectionMap( currentMapInfo.filename );
+        }
+
+        return world.LoadMapMP2( currentMapInfo.filename, ( currentMapInfo.version == GameVersion::SUCCESSION_WARS ) );
+    }
+
+    void benchmarkPathfinder( const fheroes2::BenchmarkParameters & parameters )
+    {
+        AIWorldPathfinder pathfinder;
+
+        double totalTimeMs = 0;
+        int32_t heroCount = 0;
+
+        for ( const PlayerColor color : PlayerColorsVector( Settings::Get().GetPlayers().GetColors() ) ) {
+            for ( const Heroes * hero : world.GetKingdom( color ).GetHeroes() ) {
+                // Resetting the pathfinder forces the full re-evaluation of the map but keeps the memory allocated by the previous runs,
+                // which matches what happens in the AI turn processing.
+                pathfinder.reset();
+                pathfinder.reEvaluateIfNeeded( *hero );
+
+                const fheroes2::Time timer;
+
+                for ( int32_t i = 0; i < parameters.iterations; ++i ) {
+                    pathfinder.reset();
+                    pathfinder.reEvaluateIfNeeded( *hero );
+                }
+
+                const double timeMs = timer.getMs();
+                const double averageTimeMs = timeMs / parameters.iterations;
+
+                COUT( "  " << hero->GetName() << " (" << Color::String( color ) << "): " << averageTimeMs << " ms per re-evaluation" )
+
+                totalTimeMs += averageTimeMs;
+                ++heroCount;
+            }
+        }
+
+        if ( heroCount == 0 ) {
+            COUT( "  There are no heroes on the map." )
+            return;
+        }
+
+        COUT( "  Total: " << heroCount << " heroes, " << totalTimeMs << " ms to re-evaluate all of them, " << totalTimeMs / heroCount << " ms per hero" )
+    }
+
+    // Battles are played between the first hero on the map and the monsters on this number of tiles.
+    const size_t maxBattlePathfinderBenchmarkBattleCount{ 16 };
+
+    void benchmarkBattlePathfinder( const fheroes2::BenchmarkParameters & parameters )
+    {
+        Heroes * hero = nullptr;
+
+        for ( const PlayerColor color : PlayerColorsVector( Settings::Get().GetPlayers().GetColors() ) ) {
+            const VecHeroes & heroes = world.GetKingdom( color ).GetHeroes();
+            if ( !heroes.empty() ) {
+                hero = heroes.front();
+                break;
+            }
+        }
+
+        if ( hero == nullptr ) {
+            COUT( "  There are no heroes on the map." )
+            return;
+        }
+
+        std::vector<int32_t> monsterTileIndexes;
+
+        const int32_t tileCount = static_cast<int32_t>( world.getSize() );
+        for ( int32_t i = 0; i < tileCount && monsterTileIndexes.size() < maxBattlePathfinderBenchmarkBattleCount; ++i ) {
+            if ( world.getTile( i ).getMainObjectType() == MP2::OBJ_MONSTER ) {
+                monsterTileIndexes.push_back( i );
+            }
+        }
+
+        if ( monsterTileIndexes.empty() ) {
+            COUT( "  There are no monsters on the map." )
+            return;
+        }
+
+        double totalTimeMs = 0;
+        size_t boardStateCount = 0;
+        size_t callCount = 0;
+        size_t checksum = 0;
+
+        for ( const int32_t tileIndex : monsterTileIndexes ) {
+            Army monsters( world.getTile( tileIndex ) );
+
+            // Battles are played by a copy of the hero's army, so the hero (e.g. his spell points) is the same in every battle.
+            AI::SimulatedArmy heroArmy( hero->GetArmy() );
+
+            Rand::PCG32 randomGenerator( static_cast<uint32_t>( tileIndex ) );
+            Battle::Arena arena( heroArmy.get(), monsters, tileIndex, false, randomGenerator );
+
+            // Every turn of the battle gives a new state of the board. Available moves of all units are requested in turn, as the battle AI does,
+            // so every request rebuilds the graph of positions, unless there is only one unit on the board.
+            while ( arena.BattleValid() ) {
+                std::vector<const Battle::Unit *> units;
+
+                for ( const Battle::Force * force : { &arena.getAttackingForce(), &arena.getDefendingForce() } ) {
+                    for ( const Battle::Unit * unit : force->getUnits() ) {
+                        if ( unit->isValid() && unit->GetHeadIndex() != -1 ) {
+                            units.push_back( unit );
+                        }
+                    }
+                }
+
+                const fheroes2::Time timer;
+
+                for ( int32_t iteration = 0; iteration < parameters.iterations; ++iteration ) {
+                    for ( const Battle::Unit * unit : units ) {
+                        checksum += arena.getAllAvailableMoves( *unit ).size();
+                    }
+                }
+
+                totalTimeMs += timer.getS() * 1000;
+                callCount += units.size() * static_cast<size_t>( parameters.iterations );
+                ++boardStateCount;
+
+                arena.Turns();
+            }
+        }
+
+        if ( callCount == 0 ) {
+            COUT( "  No board states have been recorded." )
+            return;
+        }
+
+        COUT( "  " << monsterTileIndexes.size() << " battles of " << hero->GetName() << ", " << boardStateCount << " board states, " << callCount << " calls" )
+        COUT( "  " << totalTimeMs * 1000 / callCount << " us per call of getAllAvailableMoves() (checksum " << checksum << ")" )
+    }
+
+    void benchmarkTiles( const fheroes2::BenchmarkParameters & parameters )
+    {
+        const int32_t tileCount = static_cast<int32_t>( world.getSize() );
+
+        size_t groundPartCount = 0;
+        size_t topPartCount = 0;
+        size_t allocationCount = 0;
+        size_t allocatedBytes = 0;
+
+        const auto addObjectParts = [&allocationCount, &allocatedBytes]( const std::vector<Maps::ObjectPart> & parts ) {
+            if ( parts.capacity() > 0 ) {
+                ++allocationCount;
+                allocatedBytes += parts.capacity() * sizeof( Maps::ObjectPart );
+            }
+
+            return parts.size();
+        };
+
+        for ( int32_t i = 0; i < tileCount; ++i ) {
+            const Maps::Tile & tile = world.getTile( i );
+
+            groundPartCount += addObjectParts( tile.getGroundObjectParts() );
+            topPartCount += addObjectParts( tile.getTopObjectParts() );
+        }
+
+        COUT( "  Tiles: " << tileCount << ", " << sizeof( Maps::Tile ) << " bytes per tile, " << tileCount * sizeof( Maps::Tile ) / 1024 << " KB in total" )
+        COUT( "  Object parts: " << groundPartCount << " on the ground level, " << topPartCount << " on the top level" )
+        COUT( "  Object part storage: " << allocationCount << " heap allocations, " << allocatedBytes / 1024 << " KB" )
+
+        // Go through all object parts of all tiles in the same way as the rendering and the AI object scans do.
+        uint32_t checksum = 0;
+
+        const fheroes2::Time timer;
+
+        for ( int32_t iteration = 0; iteration < parameters.iterations; ++iteration ) {
+            for ( int32_t i = 0; i < tileCount; ++i ) {
+                const Maps::Tile & tile = world.getTile( i );
+
+                for ( const Maps::ObjectPart & part : tile.getGroundObjectParts() ) {
+                    checksum += part._uid + part.icnIndex;
+                }
+
+                for ( const Maps::ObjectPart & part : tile.getTopObjectParts() ) {
+                    checksum += part._uid + part.icnIndex;
+                }
+            }
+        }
+
+        COUT( "  " << timer.getMs() / parameters.iterations << " ms to go through all object parts (checksum " << checksum << ")" )
+    }
+
+    uint64_t getFileSize( const std::string & filePath )
+    {
+        uint64_t size = 0;
+        int64_t modificationTime = 0;
+
+        if ( !System::getFileSizeAndModificationTime( filePath, size, modificationTime ) ) {
+            return 0;
+        }
+
+        return size;
+    }
+
+    void benchmarkAutoSave( const fheroes2::BenchmarkParameters & parameters )
+    {
+        const std::string saveDir = Game::GetSaveDir();
+        System::MakeDirectory( saveDir );
+
+        const std::string fullSaveFilePath = System::concatPath( saveDir, "BENCHMARK_FULL" + Game::GetSaveFileExtension() );
+        const std::string deltaSaveFilePath = System::concatPath( saveDir, "BENCHMARK_DELTA" + Game::GetSaveFileExtension() );
+        const std::string deltaSaveBaseFilePath = deltaSaveFilePath + ".base";
+
+        double fullSaveTimeMs = 0;
+        double deltaSaveTimeMs = 0;
+        uint64_t fullSaveSize = 0;
+        uint64_t deltaSaveSize = 0;
+
+        for ( int32_t iteration = 0; iteration < parameters.iterations; ++iteration ) {
+            // Every save is made on the next game day, like autosaves are.
+            world.NewDay();
+
+            const fheroes2::Time fullSaveTimer;
+
+            if ( !Game::Save( fullSaveFilePath ) ) {
+                COUT( "  Failed to write " << fullSaveFilePath )
+                return;
+            }
+
+            fullSaveTimeMs += fullSaveTimer.getMs();
+
+            const fheroes2::Time deltaSaveTimer;
+
+            // Autosaves are written in the background, so the result of writing is known only after waiting for it.
+            if ( !Game::Save( deltaSaveFilePath, true ) || !Game::waitForBackgroundSaves() ) {
+                COUT( "  Failed to write " << deltaSaveFilePath )
+                return;
+            }
+
+            deltaSaveTimeMs += deltaSaveTimer.getMs();
+
+            fullSaveSize += getFileSize( fullSaveFilePath );
+            deltaSaveSize += getFileSize( deltaSaveFilePath );
+
+            // Both saves are made from the same game state, so the game data restored from the delta save must be the same as the one of the full save.
+            std::vector<uint8_t> fullSaveData;
+            std::vector<uint8_t> deltaSaveData;
+
+            if ( !Game::readSaveFileGameData( fullSaveFilePath, fullSaveData ) || !Game::readSaveFileGameData( deltaSaveFilePath, deltaSaveData ) ) {
+                COUT( "  Failed to read the save files" )
+                return;
+            }
+
+            if ( fullSaveData != deltaSaveData ) {
+                COUT( "  The game data of " << deltaSaveFilePath << " does not match the game data of " << fullSaveFilePath << " on iteration " << iteration )
+                return;
+            }
+        }
+
+        const uint64_t deltaSaveBaseSize = getFileSize( deltaSaveBaseFilePath );
+
+        System::Unlink( fullSaveFilePath );
+        System::Unlink( deltaSaveFilePath );
+        System::Unlink( deltaSaveBaseFilePath );
+
+        COUT( "  Full saves: " << fullSaveTimeMs / parameters.iterations << " ms and " << fullSaveSize / parameters.iterations / 1024 << " KB per save" )
+        // The time of delta saves includes writing of their base from time to time.
+        COUT( "  Delta saves: " << deltaSaveTimeMs / parameters.iterations << " ms and " << deltaSaveSize / parameters.iterations / 1024 << " KB per save, "
+                                << deltaSaveBaseSize / 1024 << " KB for the last base" )
+    }
+}
+
+namespace fheroes2
+{
+    bool parseBenchmarkArguments( const int argc, const char * const * argv, BenchmarkParameters & parameters )
+    {
+        if ( argc < 3 || std::string_view( argv[1] ) != "--benchmark" ) {
+            return false;
+        }
+
+        parameters = {};
+        parameters.name = argv[2];
+
+        for ( int i = 3; i < argc; ++i ) {
+            const std::string_view option( argv[i] );
+
+            if ( option == "--iterations" && i + 1 < argc ) {
+                ++i;
+
+                char * end = nullptr;
+                const long value = std::strtol( argv[i], &end, 10 );
+                if ( end == argv[i] || *end != '\0' || value < 1 ) {
+                    ERROR_LOG( "Invalid number of benchmark iterations '" << argv[i] << "'." )
+                    continue;
+                }
+
+                parameters.iterations = static_cast<int32_t>( std::min( value, 1000000L ) );
+            }
+            else {
+                parameters.mapPaths.emplace_back( option );
+            }
+        }
+
+        return true;
+    }
+
+    bool runBenchmark( const BenchmarkParameters & parameters )
+    {
+        void ( *benchmark )( const BenchmarkParameters & ) = nullptr;
+
+        if ( parameters.name == "pathfinder" ) {
+            benchmark = benchmarkPathfinder;
+        }
+        else if ( parameters.name == "battle_pathfinder" ) {
+            benchmark = benchmarkBattlePathfinder;
+        }
+        else if ( parameters.name == "tiles" ) {
+            benchmark = benchmarkTiles;
+        }
+        else if ( parameters.name == "autosave" ) {
+            benchmark = benchmarkAutoSave;
+        }
+        else {
+            ERROR_LOG( "Unknown benchmark '" << parameters.name << "'." )
+            return false;
+        }
+
+        if ( parameters.mapPaths.empty() ) {
+            ERROR_LOG( "No maps are given for benchmark '" << parameters.name << "'." )
+            return false;
+        }
+
+        for ( const std::string & mapPath : parameters.mapPaths ) {
+            if ( !loadMap( mapPath ) ) {
+                ERROR_LOG( "Failed to load map '" << mapPath << "' for benchmark." )
+                return false;
+            }
+
+            COUT( "Benchmark '" << parameters.name << "' on map '" << mapPath << "' (" << world.w() << "x" << world.h() << "), " << parameters.iterations
+                                << " iterations:" )
+
+            benchmark( parameters );
+        }
+
+        return true;
+    }
+}
@@ -0,0 +1,48 @@
+/***************************************************************************
+ *   fheroes2: https://github.com/ihhub/fheroes2                           *
+ *   Copyright (C) 2026                                                    *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace fheroes2
+{
+    // Parameters of a benchmark run without any UI, audio or user input. Benchmarks are started from the command line:
+    // fheroes2 --benchmark <name> [--iterations <count>] <map> [<map>...]
+    struct BenchmarkParameters final
+    {
+        std::string name;
+
+        std::vector<std::string> mapPaths;
+
+        // The number of times every measured operation is repeated.
+        int32_t iterations{ 100 };
+    };
+
+    // Returns true if the command line requests a benchmark run. The parameters are filled only in this case.
+    bool parseBenchmarkArguments( const int argc, const char * const * argv, BenchmarkParameters & parameters );
+
+    // Runs the requested benchmark on every given map and prints the results. The display must be switched to headless mode before calling this function.
+    // Returns false if the benchmark is unknown or any of the maps cannot be loaded.
+    bool runBenchmark( const BenchmarkParameters & parameters );
+}
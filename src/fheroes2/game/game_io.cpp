@@ -24,11 +24,19 @@
 #include "game_io.h"
 
 #include <algorithm>
+#include <cassert>
 #include <cctype>
+#include <condition_variable>
 #include <cstdint>
+#include <cstring>
 #include <ctime>
+#include <deque>
+#include <memory>
+#include <mutex>
 #include <ostream>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "campaign_savedata.h"
 #include "campaign_scenariodata.h"
@@ -42,6 +50,8 @@
 #include "serialize.h"
 #include "settings.h"
 #include "system.h"
+#include "thread.h"
+#include "tools.h"
 #include "translations.h"
 #include "ui_dialog.h"
 #include "ui_font.h"
@@ -65,6 +75,8 @@ namespace
     {
         enum
         {
+            // The game data of such save file contains only the changes since its base save file.
+            IS_DELTA_SAVE = 0x2000,
             REQUIRES_POL_RESOURCES = 0x4000
         };
 
@@ -101,6 +113,468 @@ namespace
     {
         return stream >> hdr.requirements >> hdr.info >> hdr.gameType;
     }
+
+    // Contents of a save file taken at the moment of saving, so the game state can change while the file is being written.
+    struct SaveFileSnapshot final
+    {
+        std::string filePath;
+
+        HeaderSAV header;
+
+        // Game data which is compressed before being written to the file.
+        std::unique_ptr<RWStreamBuf> data;
+
+        // Offsets of the serialized map entities (tiles, heroes, castles and kingdoms) within the game data.
+        std::vector<uint32_t> entityOffsets;
+    };
+
+    bool makeSaveFileSnapshot( const std::string & filePath, SaveFileSnapshot & snapshot )
+    {
+        // Always use the latest version of the file save format
+        Game::SetVersionOfCurrentSaveFile( CURRENT_FORMAT_VERSION );
+
+        const Settings & conf = Settings::Get();
+
+        auto data = std::make_unique<RWStreamBuf>();
+        data->setBigendian( true );
+
+        std::vector<uint32_t> entityOffsets;
+
+        World::Get().serialize( *data, [&dataStream = *data, &entityOffsets]() { entityOffsets.push_back( static_cast<uint32_t>( dataStream.size() ) ); } );
+
+        *data << conf << GameOver::Result::Get();
+        if ( data->fail() ) {
+            return false;
+        }
+
+        if ( conf.isCampaignGameType() ) {
+            *data << Campaign::CampaignSaveData::Get();
+        }
+
+        // End-of-data marker
+        *data << saveFileMagicNumber;
+        if ( data->fail() ) {
+            return false;
+        }
+
+        snapshot.filePath = filePath;
+        snapshot.header = HeaderSAV( conf.getCurrentMapInfo(), conf.GameType(), world.GetDay(), world.GetWeek(), world.GetMonth() );
+        snapshot.data = std::move( data );
+        snapshot.entityOffsets = std::move( entityOffsets );
+
+        return true;
+    }
+
+    // Writes the save file with the given header and the game data which has been already compressed.
+    bool writeCompressedSaveFile( const std::string & filePath, const HeaderSAV & header, const RWStreamBuf & compressedData )
+    {
+        // The file is written under a temporary name and then renamed, so the previous save file with the same name is kept intact
+        // if the game is closed or crashes in the middle of writing.
+        const std::string tempFilePath = filePath + ".tmp";
+
+        {
+            StreamFile fileStream;
+            fileStream.setBigendian( true );
+
+            if ( !fileStream.open( tempFilePath, "wb" ) ) {
+                DEBUG_LOG( DBG_GAME, DBG_WARN, "Error opening the file " << tempFilePath )
+                return false;
+            }
+
+            const uint16_t saveFileVersion = CURRENT_FORMAT_VERSION;
+
+            fileStream << saveFileMagicNumber << std::to_string( saveFileVersion ) << saveFileVersion << header;
+            fileStream.putRaw( compressedData.data(), compressedData.size() );
+
+            if ( fileStream.fail() ) {
+                ERROR_LOG( "Error writing the file " << tempFilePath )
+
+                fileStream.close();
+                System::Unlink( tempFilePath );
+
+                return false;
+            }
+        }
+
+        if ( !System::renameFile( tempFilePath, filePath ) ) {
+            ERROR_LOG( "Error renaming the file " << tempFilePath << " to " << filePath )
+
+            System::Unlink( tempFilePath );
+
+            return false;
+        }
+
+        return true;
+    }
+
+    bool compressSaveFileData( const IStreamBuf & data, RWStreamBuf & compressedData )
+    {
+        compressedData.setBigendian( true );
+
+        if ( !Compression::zipStreamBuf( data, compressedData ) ) {
+            ERROR_LOG( "Error compressing the game data" )
+            return false;
+        }
+
+        return true;
+    }
+
+    bool writeSaveFile( const std::string & filePath, const HeaderSAV & header, const IStreamBuf & data )
+    {
+        RWStreamBuf compressedData;
+
+        return compressSaveFileData( data, compressedData ) && writeCompressedSaveFile( filePath, header, compressedData );
+    }
+
+    // Reads the game data of a full save file of the given version skipping all other checks of its header.
+    bool readSaveFileData( const std::string & filePath, const uint16_t expectedSaveFileVersion, RWStreamBuf & data )
+    {
+        StreamFile fileStream;
+        fileStream.setBigendian( true );
+
+        if ( !fileStream.open( filePath, "rb" ) ) {
+            return false;
+        }
+
+        uint16_t magicNumber = 0;
+        std::string saveFileVersionStr;
+        uint16_t saveFileVersion = 0;
+        HeaderSAV header;
+
+        fileStream >> magicNumber >> saveFileVersionStr >> saveFileVersion >> header;
+
+        if ( fileStream.fail() || magicNumber != saveFileMagicNumber || saveFileVersion != expectedSaveFileVersion
+             || ( header.requirements & HeaderSAV::IS_DELTA_SAVE ) ) {
+            return false;
+        }
+
+        return Compression::unzipStream( fileStream, data );
+    }
+
+    std::string getDeltaSaveBaseFilePath( const std::string & filePath )
+    {
+        return filePath + ".base";
+    }
+
+    // Returns the size of the given entity of the serialized game data. The last entity ends at the end of the data.
+    uint32_t getEntitySize( const std::vector<uint32_t> & entityOffsets, const size_t dataSize, const size_t entityId )
+    {
+        const size_t begin = ( entityId == 0 ) ? 0 : entityOffsets[entityId - 1];
+        const size_t end = ( entityId < entityOffsets.size() ) ? entityOffsets[entityId] : dataSize;
+
+        assert( begin <= end );
+
+        return static_cast<uint32_t>( end - begin );
+    }
+
+    // Rolling autosaves store only the map entities (tiles, heroes, castles and kingdoms) changed since the last full save, which is
+    // called the base and is written next to the autosave file. The game data of a delta save file has the following layout:
+    //
+    // - uint32_t: the size of the game data of the base
+    // - uint32_t: CRC32 checksum of the game data of the base
+    // - std::vector<uint32_t>: sizes of all entities of the base except the last one which ends at the end of the data
+    // - uint32_t: the number of the changed entities, followed by the ID, the size and the data of every changed entity
+    // - uint16_t: end-of-data marker
+    //
+    // The game data of the delta save file is restored by replacing the changed entities of the base, after that it is loaded as
+    // a regular save file. Whenever a new base is written, the save file is written as a full save file first.
+    class DeltaSaveWriter final
+    {
+    public:
+        bool write( const SaveFileSnapshot & snapshot )
+        {
+            assert( snapshot.data );
+
+            const std::string baseFilePath = getDeltaSaveBaseFilePath( snapshot.filePath );
+
+            RWStreamBuf delta;
+            delta.setBigendian( true );
+
+            const bool isBaseSuitable = ( _baseFilePath == baseFilePath && _deltaCount < maxDeltaSavesPerBase );
+
+            // A new base is written when too many changes have accumulated since the last one, so delta save files stay small.
+            if ( isBaseSuitable && _writeDelta( snapshot, delta ) && delta.size() <= _baseData.size() / 2 ) {
+                return _writeDeltaFile( snapshot, delta );
+            }
+
+            _baseFilePath.clear();
+
+            // When the base is changed, the save file itself is written as a full save file before the new base replaces the old one,
+            // so at any moment the save file can be loaded even if the game is closed or crashes in the middle of this process.
+            RWStreamBuf compressedData;
+            if ( !compressSaveFileData( *snapshot.data, compressedData ) || !writeCompressedSaveFile( snapshot.filePath, snapshot.header, compressedData )
+                 || !writeCompressedSaveFile( baseFilePath, snapshot.header, compressedData ) ) {
+                return false;
+            }
+
+            _baseFilePath = baseFilePath;
+            _baseData.assign( snapshot.data->data(), snapshot.data->data() + snapshot.data->size() );
+            _baseEntityOffsets = snapshot.entityOffsets;
+            _baseChecksum = fheroes2::calculateCRC32( _baseData.data(), _baseData.size() );
+            _deltaCount = 0;
+
+            return true;
+        }
+
+    private:
+        // The number of delta save files written after a base before the next base is written.
+        static constexpr uint32_t maxDeltaSavesPerBase{ 7 };
+
+        std::string _baseFilePath;
+
+        std::vector<uint8_t> _baseData;
+        std::vector<uint32_t> _baseEntityOffsets;
+        uint32_t _baseChecksum{ 0 };
+
+        uint32_t _deltaCount{ 0 };
+
+        bool _writeDelta( const SaveFileSnapshot & snapshot, RWStreamBuf & delta ) const
+        {
+            const std::vector<uint32_t> & entityOffsets = snapshot.entityOffsets;
+            if ( entityOffsets.size() != _baseEntityOffsets.size() ) {
+                return false;
+            }
+
+            const size_t entityCount = entityOffsets.size() + 1;
+
+            delta.put32( static_cast<uint32_t>( _baseData.size() ) );
+            delta.put32( _baseChecksum );
+
+            delta.put32( static_cast<uint32_t>( _baseEntityOffsets.size() ) );
+            for ( size_t entityId = 0; entityId < _baseEntityOffsets.size(); ++entityId ) {
+                delta.put32( getEntitySize( _baseEntityOffsets, _baseData.size(), entityId ) );
+            }
+
+            const uint8_t * data = snapshot.data->data();
+            const size_t dataSize = snapshot.data->size();
+
+            std::vector<uint32_t> changedEntityIds;
+
+            for ( size_t entityId = 0; entityId < entityCount; ++entityId ) {
+                const uint32_t size = getEntitySize( entityOffsets, dataSize, entityId );
+                const uint32_t baseSize = getEntitySize( _baseEntityOffsets, _baseData.size(), entityId );
+
+                const uint8_t * entity = data + ( entityId == 0 ? 0 : entityOffsets[entityId - 1] );
+                const uint8_t * baseEntity = _baseData.data() + ( entityId == 0 ? 0 : _baseEntityOffsets[entityId - 1] );
+
+                if ( size != baseSize || std::memcmp( entity, baseEntity, size ) != 0 ) {
+                    changedEntityIds.push_back( static_cast<uint32_t>( entityId ) );
+                }
+            }
+
+            delta.put32( static_cast<uint32_t>( changedEntityIds.size() ) );
+
+            for ( const uint32_t entityId : changedEntityIds ) {
+                const uint32_t size = getEntitySize( entityOffsets, dataSize, entityId );
+
+                delta.put32( entityId );
+                delta.put32( size );
+                delta.putRaw( data + ( entityId == 0 ? 0 : entityOffsets[entityId - 1] ), size );
+            }
+
+            delta << saveFileMagicNumber;
+
+            return !delta.fail();
+        }
+
+        bool _writeDeltaFile( const SaveFileSnapshot & snapshot, const RWStreamBuf & delta )
+        {
+            HeaderSAV header = snapshot.header;
+            header.requirements |= HeaderSAV::IS_DELTA_SAVE;
+
+            if ( !writeSaveFile( snapshot.filePath, header, delta ) ) {
+                return false;
+            }
+
+            ++_deltaCount;
+
+            return true;
+        }
+    };
+
+    // Restores the full game data of a delta save file using its base. Returns false if the base is missing or does not match.
+    bool restoreDeltaSaveData( const std::string & filePath, IStreamBase & delta, RWStreamBuf & data )
+    {
+        const uint32_t baseDataSize = delta.get32();
+        const uint32_t baseChecksum = delta.get32();
+
+        std::vector<uint32_t> baseEntitySizes;
+        delta >> baseEntitySizes;
+
+        if ( delta.fail() ) {
+            return false;
+        }
+
+        RWStreamBuf baseData;
+        baseData.setBigendian( true );
+
+        const std::string baseFilePath = getDeltaSaveBaseFilePath( filePath );
+
+        // The base is always written along with the delta save file, so they have the same version.
+        if ( !readSaveFileData( baseFilePath, Game::GetVersionOfCurrentSaveFile(), baseData ) ) {
+            ERROR_LOG( "Failed to read the base save file " << baseFilePath )
+            return false;
+        }
+
+        if ( baseData.size() != baseDataSize || fheroes2::calculateCRC32( baseData.data(), baseData.size() ) != baseChecksum ) {
+            ERROR_LOG( "The base save file " << baseFilePath << " does not match the save file " << filePath )
+            return false;
+        }
+
+        // Offsets of the entities of the base.
+        std::vector<uint32_t> baseEntityOffsets;
+        baseEntityOffsets.reserve( baseEntitySizes.size() );
+
+        size_t offset = 0;
+        for ( const uint32_t size : baseEntitySizes ) {
+            offset += size;
+            if ( offset > baseDataSize ) {
+                return false;
+            }
+
+            baseEntityOffsets.push_back( static_cast<uint32_t>( offset ) );
+        }
+
+        const size_t entityCount = baseEntityOffsets.size() + 1;
+
+        const auto copyBaseEntities = [&baseData, &baseEntityOffsets, &data]( const size_t firstEntityId, const size_t lastEntityId ) {
+            if ( firstEntityId >= lastEntityId ) {
+                return;
+            }
+
+            const size_t begin = ( firstEntityId == 0 ) ? 0 : baseEntityOffsets[firstEntityId - 1];
+            const size_t end = ( lastEntityId - 1 < baseEntityOffsets.size() ) ? baseEntityOffsets[lastEntityId - 1] : baseData.size();
+
+            data.putRaw( baseData.data() + begin, end - begin );
+        };
+
+        const uint32_t changedEntityCount = delta.get32();
+
+        size_t nextEntityId = 0;
+
+        for ( uint32_t i = 0; i < changedEntityCount; ++i ) {
+            const uint32_t entityId = delta.get32();
+            const uint32_t size = delta.get32();
+
+            if ( delta.fail() || entityId < nextEntityId || entityId >= entityCount ) {
+                return false;
+            }
+
+            copyBaseEntities( nextEntityId, entityId );
+
+            const std::vector<uint8_t> entity = delta.getRaw( size );
+            if ( delta.fail() || entity.size() != size ) {
+                return false;
+            }
+
+            data.putRaw( entity.data(), entity.size() );
+
+            nextEntityId = entityId + 1;
+        }
+
+        copyBaseEntities( nextEntityId, entityCount );
+
+        uint16_t endOfDataMarker = 0;
+        delta >> endOfDataMarker;
+
+        return !delta.fail() && !data.fail() && endOfDataMarker == saveFileMagicNumber;
+    }
+
+    // Compression of the game data of a large map takes a noticeable amount of time, so autosaves are compressed and written
+    // by a separate thread while the game continues.
+    class AsyncSaveManager final : public MultiThreading::AsyncManager
+    {
+    public:
+        AsyncSaveManager() = default;
+        AsyncSaveManager( const AsyncSaveManager & ) = delete;
+
+        ~AsyncSaveManager() override
+        {
+            // Save files that have already been scheduled must be written before the application exits. Since this class is final,
+            // the worker thread is stopped before any part of this object is destroyed.
+            waitForCompletion();
+            stopWorker();
+        }
+
+        AsyncSaveManager & operator=( const AsyncSaveManager & ) = delete;
+
+        void pushSave( SaveFileSnapshot snapshot )
+        {
+            createWorker();
+
+            const std::scoped_lock<std::mutex> lock( _mutex );
+
+            _pendingSaves.emplace_back( std::move( snapshot ) );
+
+            notifyWorker();
+        }
+
+        // Waits until all scheduled save files are written. Returns false if writing of any of them has failed since the previous call.
+        bool waitForCompletion()
+        {
+            std::unique_lock<std::mutex> lock( _mutex );
+
+            _completionNotification.wait( lock, [this] { return _pendingSaves.empty() && !_isSaveInProgress; } );
+
+            return !std::exchange( _hasFailedSaves, false );
+        }
+
+    private:
+        std::deque<SaveFileSnapshot> _pendingSaves;
+        SaveFileSnapshot _currentSave;
+
+        // It is used only by the worker thread.
+        DeltaSaveWriter _deltaSaveWriter;
+
+        bool _isSaveInProgress{ false };
+        bool _hasFailedSaves{ false };
+
+        std::condition_variable _completionNotification;
+
+        // This method is called by the worker thread and is protected by _mutex
+        bool prepareTask() override
+        {
+            if ( _pendingSaves.empty() ) {
+                return false;
+            }
+
+            _currentSave = std::move( _pendingSaves.front() );
+            _pendingSaves.pop_front();
+
+            _isSaveInProgress = true;
+
+            return true;
+        }
+
+        // This method is called by the worker thread, but is not protected by _mutex
+        void executeTask() override
+        {
+            if ( !_currentSave.data ) {
+                // Nothing to do.
+                return;
+            }
+
+            const bool isWritten = _deltaSaveWriter.write( _currentSave );
+            if ( !isWritten ) {
+                ERROR_LOG( "Failed to write the save file " << _currentSave.filePath )
+            }
+
+            {
+                const std::scoped_lock<std::mutex> lock( _mutex );
+
+                _currentSave = {};
+                _isSaveInProgress = false;
+
+                if ( !isWritten ) {
+                    _hasFailedSaves = true;
+                }
+            }
+
+            _completionNotification.notify_all();
+        }
+    };
+
+    AsyncSaveManager asyncSaveManager;
 }
 
 bool Game::AutoSave()
@@ -117,47 +591,78 @@ bool Game::Save( const std::string & filePath, const bool autoSave /* = false */
 {
     DEBUG_LOG( DBG_GAME, DBG_INFO, filePath )
 
+    SaveFileSnapshot snapshot;
+    if ( !makeSaveFileSnapshot( filePath, snapshot ) ) {
+        return false;
+    }
+
+    if ( autoSave ) {
+        asyncSaveManager.pushSave( std::move( snapshot ) );
+
+        return true;
+    }
+
+    // Other saves are requested by the player who expects to see the result of saving right away. Wait for the autosave
+    // in progress (if any) to make sure that the files are written in the order in which they were requested.
+    asyncSaveManager.waitForCompletion();
+
+    if ( !writeSaveFile( snapshot.filePath, snapshot.header, *snapshot.data ) ) {
+        return false;
+    }
+
+    Game::SetLastSaveName( filePath );
+
+    return true;
+}
+
+bool Game::waitForBackgroundSaves()
+{
+    return asyncSaveManager.waitForCompletion();
+}
+
+bool Game::readSaveFileGameData( const std::string & filePath, std::vector<uint8_t> & data )
+{
+    asyncSaveManager.waitForCompletion();
+
     StreamFile fileStream;
     fileStream.setBigendian( true );
 
-    if ( !fileStream.open( filePath, "wb" ) ) {
-        DEBUG_LOG( DBG_GAME, DBG_WARN, "Error opening the file " << filePath )
+    if ( !fileStream.open( filePath, "rb" ) ) {
         return false;
     }
 
-    // Always use the latest version of the file save format
-    SetVersionOfCurrentSaveFile( CURRENT_FORMAT_VERSION );
-    const uint16_t saveFileVersion = CURRENT_FORMAT_VERSION;
+    uint16_t magicNumber = 0;
+    std::string saveFileVersionStr;
+    uint16_t saveFileVersion = 0;
+    HeaderSAV header;
 
-    // Header
-    const Settings & conf = Settings::Get();
+    fileStream >> magicNumber >> saveFileVersionStr >> saveFileVersion >> header;
 
-    fileStream << saveFileMagicNumber << std::to_string( saveFileVersion ) << saveFileVersion
-               << HeaderSAV( conf.getCurrentMapInfo(), conf.GameType(), world.GetDay(), world.GetWeek(), world.GetMonth() );
-    if ( fileStream.fail() ) {
+    if ( fileStream.fail() || magicNumber != saveFileMagicNumber || saveFileVersion > CURRENT_FORMAT_VERSION || saveFileVersion < LAST_SUPPORTED_FORMAT_VERSION ) {
         return false;
     }
 
+    SetVersionOfCurrentSaveFile( saveFileVersion );
+
     RWStreamBuf dataStream;
     dataStream.setBigendian( true );
 
-    dataStream << World::Get() << conf << GameOver::Result::Get();
-    if ( dataStream.fail() ) {
+    if ( !Compression::unzipStream( fileStream, dataStream ) ) {
         return false;
     }
 
-    if ( conf.isCampaignGameType() ) {
-        dataStream << Campaign::CampaignSaveData::Get();
-    }
+    if ( header.requirements & HeaderSAV::IS_DELTA_SAVE ) {
+        RWStreamBuf restoredDataStream;
+        restoredDataStream.setBigendian( true );
 
-    // End-of-data marker
-    dataStream << saveFileMagicNumber;
-    if ( dataStream.fail() || !Compression::zipStreamBuf( dataStream, fileStream ) ) {
-        return false;
-    }
+        if ( saveFileVersion < FORMAT_VERSION_PRE1_1160_RELEASE || !restoreDeltaSaveData( filePath, dataStream, restoredDataStream ) ) {
+            return false;
+        }
 
-    if ( !autoSave ) {
-        Game::SetLastSaveName( filePath );
+        data.assign( restoredDataStream.data(), restoredDataStream.data() + restoredDataStream.size() );
+    }
+    else {
+        data.assign( dataStream.data(), dataStream.data() + dataStream.size() );
     }
 
     return true;
@@ -169,6 +674,9 @@ fheroes2::GameMode Game::Load( const std::string & filePath )
 
     const auto showGenericErrorMessage = []() { fheroes2::showStandardTextMessage( _( "Error" ), _( "The save file is corrupted." ), Dialog::OK ); };
 
+    // This file may still be being written in the background.
+    asyncSaveManager.waitForCompletion();
+
     StreamFile fileStream;
     fileStream.setBigendian( true );
 
@@ -238,6 +746,24 @@ fheroes2::GameMode Game::Load( const std::string & filePath )
         return fheroes2::GameMode::CANCEL;
     }
 
+    const bool isDeltaSave = ( header.requirements & HeaderSAV::IS_DELTA_SAVE ) != 0;
+
+    // Delta save files did not exist before this version of the save format.
+    if ( isDeltaSave && saveFileVersion < FORMAT_VERSION_PRE1_1160_RELEASE ) {
+        showGenericErrorMessage();
+        return fheroes2::GameMode::CANCEL;
+    }
+
+    RWStreamBuf restoredDataStream;
+    restoredDataStream.setBigendian( true );
+
+    if ( isDeltaSave && !restoreDeltaSaveData( filePath, dataStream, restoredDataStream ) ) {
+        showGenericErrorMessage();
+        return fheroes2::GameMode::CANCEL;
+    }
+
+    RWStreamBuf & gameDataStream = isDeltaSave ? restoredDataStream : dataStream;
+
     if ( ( header.requirements & HeaderSAV::REQUIRES_POL_RESOURCES ) && !conf.isPriceOfLoyaltySupported() ) {
         fheroes2::showStandardTextMessage( _( "Error" ),
                                            _( "This save file requires \"The Price of Loyalty\" game assets, but they have not been provided to the engine." ),
@@ -246,8 +772,8 @@ fheroes2::GameMode Game::Load( const std::string & filePath )
         return fheroes2::GameMode::CANCEL;
     }
 
-    dataStream >> World::Get() >> conf >> GameOver::Result::Get();
-    if ( dataStream.fail() ) {
+    gameDataStream >> World::Get() >> conf >> GameOver::Result::Get();
+    if ( gameDataStream.fail() ) {
         showGenericErrorMessage();
         return fheroes2::GameMode::CANCEL;
     }
@@ -256,7 +782,7 @@ fheroes2::GameMode Game::Load( const std::string & filePath )
 
     if ( conf.isCampaignGameType() ) {
         Campaign::CampaignSaveData & saveData = Campaign::CampaignSaveData::Get();
-        dataStream >> saveData;
+        gameDataStream >> saveData;
 
         if ( !saveData.isStarting() && saveData.getCurrentScenarioInfoId() == saveData.getLastCompletedScenarioInfoID() ) {
             // This is the end of the current scenario. We should show next scenario selection.
@@ -265,8 +791,8 @@ fheroes2::GameMode Game::Load( const std::string & filePath )
     }
 
     uint16_t endOfDataMarker = 0;
-    dataStream >> endOfDataMarker;
-    if ( dataStream.fail() || endOfDataMarker != saveFileMagicNumber ) {
+    gameDataStream >> endOfDataMarker;
+    if ( gameDataStream.fail() || endOfDataMarker != saveFileMagicNumber ) {
         showGenericErrorMessage();
         return fheroes2::GameMode::CANCEL;
     }
@@ -308,6 +834,8 @@ bool Game::LoadSAV2FileInfo( std::string filePath, Maps::FileInfo & fileInfo )
 {
     DEBUG_LOG( DBG_GAME, DBG_INFO, filePath )
 
+    asyncSaveManager.waitForCompletion();
+
     StreamFile fs;
     fs.setBigendian( true );
 
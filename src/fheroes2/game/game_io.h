@@ -1,6 +1,6 @@
 /***************************************************************************
  *   fheroes2: https://github.com/ihhub/fheroes2                           *
- *   Copyright (C) 2019 - 2025                                             *
+ *   Copyright (C) 2019 - 2026                                             *
  *                                                                         *
  *   Free Heroes2 Engine: http://sourceforge.net/projects/fheroes2         *
  *   Copyright (C) 2009 by Andrey Afletdinov <fheroes2@gmail.com>          *
@@ -25,6 +25,7 @@
 
 #include <cstdint>
 #include <string>
+#include <vector>
 
 #include "game_mode.h"
 
@@ -49,8 +50,19 @@ namespace Game
     bool AutoSave();
     bool QuickSave();
 
+    // Autosaves are compressed and written to the file in the background, in this case the result only indicates whether
+    // the game state has been successfully serialized. Autosave files contain only the changes since the last full save
+    // which is written next to them. Other saves are full and written immediately.
     bool Save( const std::string & filePath, const bool autoSave = false );
 
+    // Waits until all autosaves being written in the background are completely written. Returns false if writing of any of
+    // them has failed since the previous call.
+    bool waitForBackgroundSaves();
+
+    // Reads the uncompressed game data of the given save file without loading it. The game data of autosave files is restored
+    // using the full save file written next to them. It is used to verify save files.
+    bool readSaveFileGameData( const std::string & filePath, std::vector<uint8_t> & data );
+
     // Returns GameMode::CANCEL in case of failure.
     fheroes2::GameMode Load( const std::string & filePath );
 
@@ -109,6 +109,9 @@ void Game::mainGameLoop( bool isFirstGameRun, bool isProbablyDemoVersion )
     bool exit = false;
 
     while ( !exit ) {
+        // No images are being held between game modes so unused images can be safely released.
+        fheroes2::AGG::trimImageCache();
+
         switch ( result ) {
         case fheroes2::GameMode::QUIT_GAME:
             exit = true;
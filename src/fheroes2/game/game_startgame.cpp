@@ -837,6 +837,10 @@ fheroes2::GameMode Interface::AdventureMap::StartGame()
             if ( kingdom.isPlay() ) {
                 DEBUG_LOG( DBG_GAME, DBG_INFO, world.DateString() << ", color: " << Color::String( playerColor ) << ", resource: " << kingdom.GetFunds().String() )
 
+                // Interface elements which exist between turns request their images on every render instead of storing references to them,
+                // so unused images can be safely released.
+                fheroes2::AGG::trimImageCache();
+
                 _radar.SetHide( true );
                 _radar.SetRedraw( REDRAW_RADAR_CURSOR );
 
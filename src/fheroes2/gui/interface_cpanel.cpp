@@ -55,10 +55,7 @@ Interface::ControlPanel::ControlPanel( AdventureMap & interface )
 
 void Interface::ControlPanel::ResetTheme()
 {
-    const int icn = Settings::Get().isEvilInterfaceEnabled() ? ICN::ADVEBTNS : ICN::ADVBTNS;
-
-    _buttons.reset( new Buttons( fheroes2::AGG::GetICN( icn, 4 ), fheroes2::AGG::GetICN( icn, 0 ), fheroes2::AGG::GetICN( icn, 12 ), fheroes2::AGG::GetICN( icn, 10 ),
-                                 fheroes2::AGG::GetICN( icn, 8 ) ) );
+    _icnId = Settings::Get().isEvilInterfaceEnabled() ? ICN::ADVEBTNS : ICN::ADVBTNS;
 }
 
 void Interface::ControlPanel::SetPos( int32_t ox, int32_t oy )
@@ -80,17 +77,17 @@ void Interface::ControlPanel::SetPos( int32_t ox, int32_t oy )
 
 void Interface::ControlPanel::_redraw() const
 {
-    assert( _buttons );
+    assert( _icnId != -1 );
 
     fheroes2::Display & display = fheroes2::Display::instance();
 
     const uint8_t alpha = 128;
 
-    fheroes2::AlphaBlit( _buttons->radar, display, rt_radar.x, rt_radar.y, alpha );
-    fheroes2::AlphaBlit( _buttons->icons, display, rt_icons.x, rt_icons.y, alpha );
-    fheroes2::AlphaBlit( _buttons->buttons, display, rt_buttons.x, rt_buttons.y, alpha );
-    fheroes2::AlphaBlit( _buttons->status, display, rt_status.x, rt_status.y, alpha );
-    fheroes2::AlphaBlit( _buttons->end, display, rt_end.x, rt_end.y, alpha );
+    fheroes2::AlphaBlit( fheroes2::AGG::GetICN( _icnId, 4 ), display, rt_radar.x, rt_radar.y, alpha );
+    fheroes2::AlphaBlit( fheroes2::AGG::GetICN( _icnId, 0 ), display, rt_icons.x, rt_icons.y, alpha );
+    fheroes2::AlphaBlit( fheroes2::AGG::GetICN( _icnId, 12 ), display, rt_buttons.x, rt_buttons.y, alpha );
+    fheroes2::AlphaBlit( fheroes2::AGG::GetICN( _icnId, 10 ), display, rt_status.x, rt_status.y, alpha );
+    fheroes2::AlphaBlit( fheroes2::AGG::GetICN( _icnId, 8 ), display, rt_end.x, rt_end.y, alpha );
 }
 
 fheroes2::GameMode Interface::ControlPanel::QueueEventProcessing() const
@@ -24,16 +24,10 @@
 #pragma once
 
 #include <cstdint>
-#include <memory>
 
 #include "game_mode.h"
 #include "math_base.h"
 
-namespace fheroes2
-{
-    class Sprite;
-}
-
 namespace Interface
 {
     class AdventureMap;
@@ -64,28 +58,8 @@ namespace Interface
     private:
         AdventureMap & _interface;
 
-        // We do not want to make a copy of images but to store just references to them.
-        struct Buttons
-        {
-            Buttons( const fheroes2::Sprite & radar_, const fheroes2::Sprite & icons_, const fheroes2::Sprite & buttons_, const fheroes2::Sprite & status_,
-                     const fheroes2::Sprite & end_ )
-                : radar( radar_ )
-                , icons( icons_ )
-                , buttons( buttons_ )
-                , status( status_ )
-                , end( end_ )
-            {
-                // Do nothing.
-            }
-
-            const fheroes2::Sprite & radar;
-            const fheroes2::Sprite & icons;
-            const fheroes2::Sprite & buttons;
-            const fheroes2::Sprite & status;
-            const fheroes2::Sprite & end;
-        };
-
-        std::unique_ptr<Buttons> _buttons;
+        // Images are requested on every render instead of being stored, since unused images can be released between turns.
+        int _icnId{ -1 };
 
         fheroes2::Rect rt_radar;
         fheroes2::Rect rt_icons;
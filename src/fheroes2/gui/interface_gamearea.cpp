@@ -32,6 +32,7 @@
 #include <map>
 #include <ostream>
 #include <type_traits>
+#include <utility>
 
 #include "agg_image.h"
 #include "castle.h"
@@ -51,6 +52,7 @@
 #include "maps_tiles.h"
 #include "maps_tiles_helper.h"
 #include "maps_tiles_render.h"
+#include "memory_arena.h"
 #include "pal.h"
 #include "players.h"
 #include "route.h"
@@ -69,22 +71,71 @@ namespace
 
     static_assert( std::is_trivially_copyable<fheroes2::ObjectRenderingInfo>::value, "This class is not trivially copyable anymore. Add std::move where required." );
 
+    using ObjectInfoStack = std::deque<fheroes2::ObjectRenderingInfo, fheroes2::ArenaAllocator<fheroes2::ObjectRenderingInfo>>;
+
+    // Image stacks of tile-unfit objects per tile. All of them are allocated from the arena which is reset for every frame.
+    class ObjectInfoStacks
+    {
+    public:
+        explicit ObjectInfoStacks( fheroes2::MemoryArena & arena )
+            : _stacks( std::less<fheroes2::Point>(), StackMap::allocator_type( arena ) )
+        {
+            // Do nothing.
+        }
+
+        ObjectInfoStack & operator[]( const fheroes2::Point & pos )
+        {
+            return _stacks.try_emplace( pos, ObjectInfoStack::allocator_type( _stacks.get_allocator() ) ).first->second;
+        }
+
+        auto begin() const
+        {
+            return _stacks.begin();
+        }
+
+        auto end() const
+        {
+            return _stacks.end();
+        }
+
+    private:
+        using StackMap = std::map<fheroes2::Point, ObjectInfoStack, std::less<fheroes2::Point>,
+                                  fheroes2::ArenaAllocator<std::pair<const fheroes2::Point, ObjectInfoStack>>>;
+
+        StackMap _stacks;
+    };
+
     struct TileUnfitRenderObjectInfo
     {
-        std::map<fheroes2::Point, std::deque<fheroes2::ObjectRenderingInfo>> bottomImages;
-        std::map<fheroes2::Point, std::deque<fheroes2::ObjectRenderingInfo>> bottomBackgroundImages;
-        std::map<fheroes2::Point, std::deque<fheroes2::ObjectRenderingInfo>> topImages;
+        explicit TileUnfitRenderObjectInfo( fheroes2::MemoryArena & arena_ )
+            : arena( arena_ )
+            , bottomImages( arena_ )
+            , bottomBackgroundImages( arena_ )
+            , topImages( arena_ )
+            , lowPriorityBottomImages( arena_ )
+            , highPriorityBottomImages( arena_ )
+            , heroBackgroundImages( arena_ )
+            , shadowImages( arena_ )
+        {
+            // Do nothing.
+        }
+
+        fheroes2::MemoryArena & arena;
+
+        ObjectInfoStacks bottomImages;
+        ObjectInfoStacks bottomBackgroundImages;
+        ObjectInfoStacks topImages;
 
-        std::map<fheroes2::Point, std::deque<fheroes2::ObjectRenderingInfo>> lowPriorityBottomImages;
-        std::map<fheroes2::Point, std::deque<fheroes2::ObjectRenderingInfo>> highPriorityBottomImages;
+        ObjectInfoStacks lowPriorityBottomImages;
+        ObjectInfoStacks highPriorityBottomImages;
 
-        std::map<fheroes2::Point, std::deque<fheroes2::ObjectRenderingInfo>> heroBackgroundImages;
+        ObjectInfoStacks heroBackgroundImages;
 
-        std::map<fheroes2::Point, std::deque<fheroes2::ObjectRenderingInfo>> shadowImages;
+        ObjectInfoStacks shadowImages;
     };
 
-    void populateStaticTileUnfitObjectInfo( TileUnfitRenderObjectInfo & tileUnfit, std::vector<fheroes2::ObjectRenderingInfo> & imageInfo,
-                                            std::vector<fheroes2::ObjectRenderingInfo> & shadowInfo, const fheroes2::Point & offset, const uint8_t alphaValue,
+    void populateStaticTileUnfitObjectInfo( TileUnfitRenderObjectInfo & tileUnfit, fheroes2::ArenaVector<fheroes2::ObjectRenderingInfo> & imageInfo,
+                                            fheroes2::ArenaVector<fheroes2::ObjectRenderingInfo> & shadowInfo, const fheroes2::Point & offset, const uint8_t alphaValue,
                                             const uint16_t fogDirection )
     {
         for ( auto & objectInfo : imageInfo ) {
@@ -137,7 +188,7 @@ namespace
         }
     }
 
-    void populateStaticTileUnfitBackgroundObjectInfo( TileUnfitRenderObjectInfo & tileUnfit, std::vector<fheroes2::ObjectRenderingInfo> & imageInfo,
+    void populateStaticTileUnfitBackgroundObjectInfo( TileUnfitRenderObjectInfo & tileUnfit, fheroes2::ArenaVector<fheroes2::ObjectRenderingInfo> & imageInfo,
                                                       const fheroes2::Point & offset, const uint8_t alphaValue )
     {
         for ( auto & objectInfo : imageInfo ) {
@@ -180,8 +231,8 @@ namespace
         const uint8_t heroAlphaValue = hero->getAlphaValue();
         const int32_t worldHeight = world.h();
 
-        auto spriteInfo = Maps::getHeroSpritesPerTile( *hero );
-        auto spriteShadowInfo = Maps::getHeroShadowSpritesPerTile( *hero );
+        auto spriteInfo = Maps::getHeroSpritesPerTile( *hero, tileUnfit.arena );
+        auto spriteShadowInfo = Maps::getHeroShadowSpritesPerTile( *hero, tileUnfit.arena );
 
         for ( auto & objectInfo : spriteInfo ) {
             const fheroes2::Point imagePos = objectInfo.tileOffset;
@@ -292,8 +343,7 @@ namespace
         }
     }
 
-    void renderImagesOnTiles( fheroes2::Image & output, const std::map<fheroes2::Point, std::deque<fheroes2::ObjectRenderingInfo>> & images,
-                              const Interface::GameArea & area )
+    void renderImagesOnTiles( fheroes2::Image & output, const ObjectInfoStacks & images, const Interface::GameArea & area )
     {
         for ( const auto & [offset, imgInfo] : images ) {
             for ( const auto & info : imgInfo ) {
@@ -407,6 +457,9 @@ void Interface::GameArea::DrawTile( fheroes2::Image & dst, const fheroes2::Image
 
 void Interface::GameArea::Redraw( fheroes2::Image & dst, int flag, bool isPuzzleDraw ) const
 {
+    // All temporary containers of the previous frame are already destroyed.
+    _renderArena.reset();
+
     const fheroes2::Rect & tileROI = GetVisibleTileROI();
 
     int32_t maxX = tileROI.x + tileROI.width;
@@ -420,6 +473,18 @@ void Interface::GameArea::Redraw( fheroes2::Image & dst, int flag, bool isPuzzle
     const bool renderFog = ( flag & LEVEL_FOG ) == LEVEL_FOG;
 #endif
 
+    bool drawPassabilities = ( flag & LEVEL_PASSABILITIES );
+
+#ifdef WITH_DEBUG
+    if ( IS_DEVEL() && ( flag & LEVEL_ALL ) ) {
+        drawPassabilities = true;
+    }
+#endif
+
+    // The terrain cache ignores fog and fading animations. Terrain under the fog is later covered by the fog images, but it is not the case
+    // when passabilities are drawn instead of the fog. Puzzle images hide some terrain objects, so the cache is not used for them either.
+    const bool useTerrainCache = !isPuzzleDraw && _animationInfo.empty() && !( renderFog && drawPassabilities );
+
     // Render terrain.
     for ( int32_t y = 0; y < tileROI.height; ++y ) {
         fheroes2::Point offset( tileROI.x, tileROI.y + y );
@@ -434,7 +499,7 @@ void Interface::GameArea::Redraw( fheroes2::Image & dst, int flag, bool isPuzzle
                 if ( offset.x < 0 || offset.x >= worldWidth ) {
                     Maps::redrawEmptyTile( dst, offset, *this );
                 }
-                else {
+                else if ( !useTerrainCache ) {
                     const Maps::Tile & tile = world.getTile( offset.x, offset.y );
                     // Do not render terrain on the tiles fully covered with the fog.
                     if ( !renderFog || tile.getFogDirection() != DIRECTION_ALL ) {
@@ -456,6 +521,10 @@ void Interface::GameArea::Redraw( fheroes2::Image & dst, int flag, bool isPuzzle
         return;
     }
 
+    if ( useTerrainCache ) {
+        _redrawCachedTerrain( dst, { minX, minY, maxX - minX, maxY - minY } );
+    }
+
     // Each tile can contain multiple object parts or sprites. Each object part has its own level or in other words layer of rendering.
     // We need to use a correct order of levels to render objects on tiles. The levels are:
     // 0 - main and action objects like mines, forest, castle and etc.
@@ -477,7 +546,7 @@ void Interface::GameArea::Redraw( fheroes2::Image & dst, int flag, bool isPuzzle
 
     const bool drawHeroes = ( flag & LEVEL_HEROES ) == LEVEL_HEROES;
 
-    TileUnfitRenderObjectInfo tileUnfit;
+    TileUnfitRenderObjectInfo tileUnfit( _renderArena );
 
     // TODO: Dragon City with Object ICN Type OBJ_ICN_TYPE_OBJNMUL2 and object index 46 is a bottom layer sprite.
     // TODO: When a hero standing besides this turns a part of the hero is visible. This can be fixed only by some hack.
@@ -491,7 +560,7 @@ void Interface::GameArea::Redraw( fheroes2::Image & dst, int flag, bool isPuzzle
 
     const bool isEditor = _interface.isEditor();
 
-    std::vector<fheroes2::Point> ghostAnimationPos;
+    fheroes2::ArenaVector<fheroes2::Point> ghostAnimationPos( fheroes2::ArenaAllocator<fheroes2::Point>{ _renderArena } );
 
     for ( int32_t posY = roiToRenderMinY; posY < roiToRenderMaxY; ++posY ) {
         const int32_t offset = posY * worldWidth;
@@ -510,9 +579,9 @@ void Interface::GameArea::Redraw( fheroes2::Image & dst, int flag, bool isPuzzle
                 if ( isEditor ) {
                     const uint8_t alphaValue = getObjectAlphaValue( tileIndex, MP2::OBJ_HERO );
 
-                    auto spriteInfo = getEditorHeroSpritesPerTile( tile );
+                    auto spriteInfo = getEditorHeroSpritesPerTile( tile, _renderArena );
 
-                    std::vector<fheroes2::ObjectRenderingInfo> temp;
+                    fheroes2::ArenaVector<fheroes2::ObjectRenderingInfo> temp( fheroes2::ArenaAllocator<fheroes2::ObjectRenderingInfo>{ _renderArena } );
                     populateStaticTileUnfitObjectInfo( tileUnfit, spriteInfo, temp, { posX, posY }, alphaValue, fogDirection );
                     continue;
                 }
@@ -546,8 +615,8 @@ void Interface::GameArea::Redraw( fheroes2::Image & dst, int flag, bool isPuzzle
 
                 const uint8_t alphaValue = getObjectAlphaValue( tileIndex, MP2::OBJ_MONSTER );
 
-                auto spriteInfo = getMonsterSpritesPerTile( tile, isEditor );
-                auto spriteShadowInfo = getMonsterShadowSpritesPerTile( tile, isEditor );
+                auto spriteInfo = getMonsterSpritesPerTile( tile, isEditor, _renderArena );
+                auto spriteShadowInfo = getMonsterShadowSpritesPerTile( tile, isEditor, _renderArena );
 
                 populateStaticTileUnfitObjectInfo( tileUnfit, spriteInfo, spriteShadowInfo, { posX, posY }, alphaValue, fogDirection );
 
@@ -565,8 +634,8 @@ void Interface::GameArea::Redraw( fheroes2::Image & dst, int flag, bool isPuzzle
 
                 const uint8_t alphaValue = getObjectAlphaValue( tileIndex, MP2::OBJ_BOAT );
 
-                auto spriteInfo = getBoatSpritesPerTile( tile );
-                auto spriteShadowInfo = getBoatShadowSpritesPerTile( tile );
+                auto spriteInfo = getBoatSpritesPerTile( tile, _renderArena );
+                auto spriteShadowInfo = getBoatShadowSpritesPerTile( tile, _renderArena );
 
                 populateStaticTileUnfitObjectInfo( tileUnfit, spriteInfo, spriteShadowInfo, { posX, posY }, alphaValue, fogDirection );
 
@@ -589,7 +658,7 @@ void Interface::GameArea::Redraw( fheroes2::Image & dst, int flag, bool isPuzzle
                 ghostAnimationPos.emplace_back( posX, posY );
             }
             else if ( objectType == MP2::OBJ_MINE && !isTileUnderFog ) {
-                auto spriteInfo = getMineGuardianSpritesPerTile( tile );
+                auto spriteInfo = getMineGuardianSpritesPerTile( tile, _renderArena );
                 if ( !spriteInfo.empty() ) {
                     const uint8_t alphaValue = getObjectAlphaValue( tile.getMainObjectPart()._uid );
                     populateStaticTileUnfitBackgroundObjectInfo( tileUnfit, spriteInfo, { posX, posY }, alphaValue );
@@ -608,8 +677,10 @@ void Interface::GameArea::Redraw( fheroes2::Image & dst, int flag, bool isPuzzle
                 continue;
             }
 
-            // Draw roads, rivers and cracks.
-            redrawBottomLayerObjects( tile, dst, isPuzzleDraw, *this, Maps::TERRAIN_LAYER );
+            // Draw roads, rivers and cracks unless they are already drawn together with the terrain.
+            if ( !useTerrainCache || !_terrainCache.isTerrainLayerCached( x + offset ) ) {
+                redrawBottomLayerObjects( tile, dst, isPuzzleDraw, *this, Maps::TERRAIN_LAYER );
+            }
 
             redrawBottomLayerObjects( tile, dst, isPuzzleDraw, *this, Maps::BACKGROUND_LAYER );
         }
@@ -660,7 +731,8 @@ void Interface::GameArea::Redraw( fheroes2::Image & dst, int flag, bool isPuzzle
     // High priority images are drawn after any other object on this tile.
     renderImagesOnTiles( dst, tileUnfit.highPriorityBottomImages, *this );
 
-    std::vector<std::pair<const Maps::ObjectPart *, int32_t>> topLayerTallObjects;
+    fheroes2::ArenaVector<std::pair<const Maps::ObjectPart *, int32_t>> topLayerTallObjects(
+        fheroes2::ArenaAllocator<std::pair<const Maps::ObjectPart *, int32_t>>{ _renderArena } );
 
     // Expand  ROI to properly render very tall objects (1 tile - left and right; 2 tiles - bottom): Abandoned mine Ghosts, Flag on the Alchemist lab, and others.
     const int32_t roiExtraObjectsMaxX = std::min( maxX + 1, worldWidth );
@@ -752,14 +824,6 @@ void Interface::GameArea::Redraw( fheroes2::Image & dst, int flag, bool isPuzzle
         }
     }
 
-    bool drawPassabilities = ( flag & LEVEL_PASSABILITIES );
-
-#ifdef WITH_DEBUG
-    if ( IS_DEVEL() && ( flag & LEVEL_ALL ) ) {
-        drawPassabilities = true;
-    }
-#endif
-
     if ( drawPassabilities ) {
         const PlayerColorsSet friendColors = Players::FriendColors();
 
@@ -795,6 +859,32 @@ void Interface::GameArea::Redraw( fheroes2::Image & dst, int flag, bool isPuzzle
     }
 
     updateObjectAnimationInfo();
+
+#ifdef WITH_DEBUG
+    // Once the arena grows enough to fit all temporary containers of a frame, rendering does not allocate memory on heap.
+    if ( _renderArena.getHeapAllocationCount() > 0 ) {
+        DEBUG_LOG( DBG_GAME, DBG_TRACE, "Temporary containers of the frame required " << _renderArena.getHeapAllocationCount() << " heap allocations." )
+    }
+#endif
+}
+
+void Interface::GameArea::_redrawCachedTerrain( fheroes2::Image & dst, const fheroes2::Rect & tileArea ) const
+{
+    const int32_t chunkSize = TerrainChunkCache::chunkSize;
+
+    const int32_t minChunkX = tileArea.x / chunkSize;
+    const int32_t minChunkY = tileArea.y / chunkSize;
+    const int32_t maxChunkX = ( tileArea.x + tileArea.width - 1 ) / chunkSize;
+    const int32_t maxChunkY = ( tileArea.y + tileArea.height - 1 ) / chunkSize;
+
+    for ( int32_t chunkY = minChunkY; chunkY <= maxChunkY; ++chunkY ) {
+        for ( int32_t chunkX = minChunkX; chunkX <= maxChunkX; ++chunkX ) {
+            const fheroes2::Image & chunkImage = _terrainCache.getChunk( { chunkX, chunkY }, tileArea );
+
+            // A chunk is drawn the same way as a single tile image but it covers many tiles.
+            DrawTile( dst, chunkImage, { chunkX * chunkSize, chunkY * chunkSize } );
+        }
+    }
 }
 
 void Interface::GameArea::redrawOnlyFog( fheroes2::Image & dst ) const
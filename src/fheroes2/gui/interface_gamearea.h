@@ -30,7 +30,9 @@
 #include <vector>
 
 #include "image.h"
+#include "interface_terrain_cache.h"
 #include "math_base.h"
+#include "memory_arena.h"
 #include "mp2.h"
 #include "timing.h"
 #include "ui_tool.h"
@@ -295,6 +297,12 @@ namespace Interface
         // This member needs to be mutable because it is modified during rendering.
         mutable std::vector<std::shared_ptr<BaseObjectAnimationInfo>> _animationInfo;
 
+        // This member needs to be mutable because it is updated during rendering.
+        mutable TerrainChunkCache _terrainCache;
+
+        // Memory for temporary containers used to render a frame. It is reset at the beginning of every frame.
+        mutable fheroes2::MemoryArena _renderArena{ 256 * 1024 };
+
         fheroes2::Point _lastMouseDragPosition;
         fheroes2::Point _mousePositionForFastScroll;
         bool _mouseDraggingInitiated{ false };
@@ -315,6 +323,9 @@ namespace Interface
 
         void _setCenterToTile( const fheroes2::Point & tile ); // set center to the middle of tile (input is tile ID)
 
+        // Renders the terrain of the given world tile area using the terrain cache.
+        void _redrawCachedTerrain( fheroes2::Image & dst, const fheroes2::Rect & tileArea ) const;
+
         void updateObjectAnimationInfo() const;
     };
 }
@@ -271,6 +271,9 @@ void Interface::Radar::redrawForEditor( const bool renderMapObjects )
     _cursorArea.hide();
 
     if ( renderMapObjects ) {
+        // The map can be changed by the editor in many ways which are not tracked by the world, so all tiles are checked.
+        _roi = { 0, 0, world.w(), world.h() };
+
         RedrawObjects( 0, ViewWorldMode::ViewAll );
         const fheroes2::Rect & rect = GetArea();
         fheroes2::Copy( _map, 0, 0, fheroes2::Display::instance(), rect.x, rect.y, _map.width(), _map.height() );
@@ -290,12 +293,26 @@ void Interface::Radar::RedrawObjects( const PlayerColorsSet playerColor, const V
 
     uint8_t * radarImage = _map.image();
 
-    assert( _roi.x >= 0 && _roi.y >= 0 && ( _roi.width + _roi.x ) <= world.w() && ( _roi.height + _roi.y ) <= world.h() );
+    const int32_t worldWidth = world.w();
+    const int32_t worldHeight = world.h();
+    const size_t tileCount = static_cast<size_t>( worldWidth ) * worldHeight;
 
-    // Fill the radar map with black color ( 0 ) only if we are redrawing the entire map.
-    if ( _roi.x == 0 && _roi.y == 0 && _roi.width == world.w() && _roi.height == world.h() ) {
+    if ( _tileColors.size() != tileCount ) {
+        // The radar map image has not been rendered for this world yet. Fill it with black color ( 0 ) and render all tiles over it.
         std::memset( radarImage, COLOR_BLACK, static_cast<size_t>( area.width ) * area.height );
+        _tileColors.assign( tileCount, COLOR_BLACK );
+
+        _roi = { 0, 0, worldWidth, worldHeight };
     }
+    else if ( playerColor != _renderedPlayerColors || flags != _renderedMode ) {
+        // The visibility of all tiles might be different.
+        _roi = { 0, 0, worldWidth, worldHeight };
+    }
+
+    _renderedPlayerColors = playerColor;
+    _renderedMode = flags;
+
+    assert( _roi.x >= 0 && _roi.y >= 0 && ( _roi.width + _roi.x ) <= worldWidth && ( _roi.height + _roi.y ) <= worldHeight );
 
     const bool revealMines = revealAll || ( flags == ViewWorldMode::ViewMines );
     const bool revealHeroes = revealAll || ( flags == ViewWorldMode::ViewHeroes );
@@ -308,114 +325,128 @@ void Interface::Radar::RedrawObjects( const PlayerColorsSet playerColor, const V
 
     const bool isZoomIn = _zoom > 1.0;
 
-    const int32_t maxRoiX = _roi.width + _roi.x;
-    const int32_t maxRoiY = _roi.height + _roi.y;
+    const auto renderTile = [&]( const int32_t x, const int32_t y ) {
+        const Maps::Tile & tile = world.getTile( x, y );
+        const bool visibleTile = revealAll || !tile.isFog( playerColor );
 
-    const uint8_t * radarYEnd = nullptr;
+        // Tiles which are not visible are black.
+        uint8_t fillColor = COLOR_BLACK;
 
-    for ( int32_t y = _roi.y; y < maxRoiY; ++y ) {
-        uint8_t * radarY = radarImage + static_cast<size_t>( y * _zoom ) * radarWidth;
-        if ( isZoomIn ) {
-            radarYEnd = radarImage + static_cast<size_t>( ( y + 1 ) * _zoom ) * radarWidth;
-        }
-
-        for ( int32_t x = _roi.x; x < maxRoiX; ++x ) {
-            const Maps::Tile & tile = world.getTile( x, y );
-            const bool visibleTile = revealAll || !tile.isFog( playerColor );
-
-            uint8_t fillColor = 0;
-
-            const MP2::MapObjectType objectType = tile.getMainObjectType( revealOnlyVisible || revealHeroes );
-            switch ( objectType ) {
-            case MP2::OBJ_HERO: {
-                if ( visibleTile || revealHeroes ) {
-                    const Heroes * hero = world.GetHeroes( { x, y } );
-                    if ( hero ) {
-                        fillColor = GetPaletteIndexFromColor( hero->GetColor() );
-                        break;
-                    }
+        const MP2::MapObjectType objectType = tile.getMainObjectType( revealOnlyVisible || revealHeroes );
+        switch ( objectType ) {
+        case MP2::OBJ_HERO: {
+            if ( visibleTile || revealHeroes ) {
+                const Heroes * hero = world.GetHeroes( { x, y } );
+                if ( hero ) {
+                    fillColor = GetPaletteIndexFromColor( hero->GetColor() );
                 }
-                continue;
             }
-            case MP2::OBJ_LIGHTHOUSE:
-            case MP2::OBJ_ALCHEMIST_LAB:
-            case MP2::OBJ_MINE:
-            case MP2::OBJ_SAWMILL:
-                // TODO: Why Lighthouse is in this category? Verify the logic!
-                if ( visibleTile || revealMines ) {
-                    fillColor = GetPaletteIndexFromColor( world.ColorCapturedObject( tile.GetIndex() ) );
-                    break;
+            break;
+        }
+        case MP2::OBJ_LIGHTHOUSE:
+        case MP2::OBJ_ALCHEMIST_LAB:
+        case MP2::OBJ_MINE:
+        case MP2::OBJ_SAWMILL:
+            // TODO: Why Lighthouse is in this category? Verify the logic!
+            if ( visibleTile || revealMines ) {
+                fillColor = GetPaletteIndexFromColor( world.ColorCapturedObject( tile.GetIndex() ) );
+            }
+            break;
+        case MP2::OBJ_NON_ACTION_LIGHTHOUSE:
+        case MP2::OBJ_NON_ACTION_ALCHEMIST_LAB:
+        case MP2::OBJ_NON_ACTION_MINE:
+        case MP2::OBJ_NON_ACTION_SAWMILL:
+            // TODO: Why Lighthouse is in this category? Verify the logic!
+            if ( visibleTile || revealMines ) {
+                const int32_t mainTileIndex = Maps::Tile::getIndexOfMainTile( tile );
+                if ( mainTileIndex >= 0 ) {
+                    fillColor = GetPaletteIndexFromColor( world.ColorCapturedObject( mainTileIndex ) );
                 }
-                continue;
-            case MP2::OBJ_NON_ACTION_LIGHTHOUSE:
-            case MP2::OBJ_NON_ACTION_ALCHEMIST_LAB:
-            case MP2::OBJ_NON_ACTION_MINE:
-            case MP2::OBJ_NON_ACTION_SAWMILL:
-                // TODO: Why Lighthouse is in this category? Verify the logic!
-                if ( visibleTile || revealMines ) {
-                    const int32_t mainTileIndex = Maps::Tile::getIndexOfMainTile( tile );
-                    if ( mainTileIndex >= 0 ) {
-                        fillColor = GetPaletteIndexFromColor( world.ColorCapturedObject( mainTileIndex ) );
-                        break;
+            }
+            break;
+        case MP2::OBJ_ARTIFACT:
+            if ( visibleTile || revealArtifacts ) {
+                fillColor = COLOR_GRAY;
+            }
+            break;
+        case MP2::OBJ_RESOURCE:
+            if ( visibleTile || revealResources ) {
+                fillColor = COLOR_GRAY;
+            }
+            break;
+        default:
+            if ( visibleTile ) {
+                // Castles and Towns can be partially covered by other non-action objects so we need to rely on special storage of castle's tiles.
+                if ( !getCastleColor( fillColor, { x, y } ) ) {
+                    // This is a visible tile and not covered by other objects, so fill it with the ground tile data.
+                    if ( tile.isRoad() ) {
+                        fillColor = COLOR_ROAD;
                     }
-                }
-                continue;
-            case MP2::OBJ_ARTIFACT:
-                if ( visibleTile || revealArtifacts ) {
-                    fillColor = COLOR_GRAY;
-                    break;
-                }
-                continue;
-            case MP2::OBJ_RESOURCE:
-                if ( visibleTile || revealResources ) {
-                    fillColor = COLOR_GRAY;
-                    break;
-                }
-                continue;
-            default:
-                if ( visibleTile ) {
-                    // Castles and Towns can be partially covered by other non-action objects so we need to rely on special storage of castle's tiles.
-                    if ( !getCastleColor( fillColor, { x, y } ) ) {
-                        // This is a visible tile and not covered by other objects, so fill it with the ground tile data.
-                        if ( tile.isRoad() ) {
-                            fillColor = COLOR_ROAD;
-                        }
-                        else {
-                            fillColor = GetPaletteIndexFromGround( tile.GetGround() );
+                    else {
+                        fillColor = GetPaletteIndexFromGround( tile.GetGround() );
 
-                            if ( objectType == MP2::OBJ_MOUNTAINS || objectType == MP2::OBJ_TREES ) {
-                                fillColor += 3;
-                            }
+                        if ( objectType == MP2::OBJ_MOUNTAINS || objectType == MP2::OBJ_TREES ) {
+                            fillColor += 3;
                         }
                     }
                 }
-                else if ( revealTowns ) {
-                    getCastleColor( fillColor, { x, y } );
-                }
-                else {
-                    // Non visible tile, we have already black radar so skip the render of this tile.
-                    continue;
-                }
             }
+            else if ( revealTowns ) {
+                getCastleColor( fillColor, { x, y } );
+            }
+        }
 
-            const size_t offsetX = static_cast<size_t>( x * _zoom );
-            uint8_t * radarX = radarY + offsetX;
-            if ( isZoomIn ) {
-                const uint8_t * radarXEnd = radarYEnd + offsetX;
-                const size_t radarXStep = static_cast<size_t>( ( x + 1 ) * _zoom ) - offsetX;
+        // Only tiles which color has changed are rendered.
+        uint8_t & renderedColor = _tileColors[static_cast<size_t>( y ) * worldWidth + x];
+        if ( renderedColor == fillColor ) {
+            return;
+        }
 
-                for ( ; radarX != radarXEnd; radarX += radarWidth ) {
-                    std::memset( radarX, fillColor, radarXStep );
-                }
-            }
-            else {
-                *radarX = fillColor;
+        renderedColor = fillColor;
+
+        const size_t offsetX = static_cast<size_t>( x * _zoom );
+        uint8_t * radarX = radarImage + static_cast<size_t>( y * _zoom ) * radarWidth + offsetX;
+        if ( isZoomIn ) {
+            const uint8_t * radarXEnd = radarImage + static_cast<size_t>( ( y + 1 ) * _zoom ) * radarWidth + offsetX;
+            const size_t radarXStep = static_cast<size_t>( ( x + 1 ) * _zoom ) - offsetX;
+
+            for ( ; radarX != radarXEnd; radarX += radarWidth ) {
+                std::memset( radarX, fillColor, radarXStep );
             }
         }
+        else {
+            *radarX = fillColor;
+        }
+    };
+
+    const int32_t maxRoiX = _roi.width + _roi.x;
+    const int32_t maxRoiY = _roi.height + _roi.y;
+
+    for ( int32_t y = _roi.y; y < maxRoiY; ++y ) {
+        for ( int32_t x = _roi.x; x < maxRoiX; ++x ) {
+            renderTile( x, y );
+        }
     }
 
-    // Reset ROI to full radar image to be able to redraw the mini-map without calling 'SetMapRedraw()'.
-    _roi = { 0, 0, world.w(), world.h() };
+    const bool isWholeWorldRendered = ( _roi.width == worldWidth && _roi.height == worldHeight );
+
+    if ( !isWholeWorldRendered ) {
+        // Tiles outside of ROI which might have been changed since the last render.
+        for ( const int32_t tileIndex : world.getRadarChangedTiles() ) {
+            renderTile( tileIndex % worldWidth, tileIndex / worldWidth );
+        }
+    }
+
+    if ( _radarType == RadarType::ViewWorld ) {
+        // This radar is temporary, the changed tiles are left for the radar of the adventure map.
+        _roi = { 0, 0, worldWidth, worldHeight };
+        return;
+    }
+
+    world.clearRadarChangedTiles();
+
+    // Only the changed tiles are rendered next time, unless a render area is set.
+    _roi = {};
 }
 
 // Redraw radar cursor. RoiRectangle is a rectangle in tile unit of the current radar view.
@@ -24,6 +24,7 @@
 #pragma once
 
 #include <cstdint>
+#include <vector>
 
 #include "color.h"
 #include "image.h"
@@ -61,7 +62,8 @@ namespace Interface
         // - 'REDRAW_RADAR_CURSOR' - to render the previously generated radar map image and the cursor over it.
         void SetRedraw( const uint32_t redrawMode ) const;
 
-        // Set the "need" of render the radar map only in the given 'roi' on next radar Redraw call.
+        // Set the "need" of render the radar map in the given 'roi' on next radar Redraw call. Tiles that have been changed
+        // in the world since the previous render are always rendered.
         void SetRenderArea( const fheroes2::Rect & roi );
         void Build();
         void RedrawForViewWorld( const ViewWorld::ZoomROIs & roi, ViewWorldMode mode, const bool renderMapObjects );
@@ -96,6 +98,12 @@ namespace Interface
         BaseInterface & _interface;
 
         fheroes2::Image _map;
+
+        // Colors of all world tiles as they are rendered on the radar map image. Only tiles which colors change are rendered again.
+        std::vector<uint8_t> _tileColors;
+        // The colors of the player and the mode used for the last render. The visibility of tiles depends on them.
+        PlayerColorsSet _renderedPlayerColors{ 0 };
+        ViewWorldMode _renderedMode{ ViewWorldMode::OnlyVisible };
         fheroes2::MovableSprite _cursorArea;
         fheroes2::Rect _roi;
         double _zoom{ 1.0 };
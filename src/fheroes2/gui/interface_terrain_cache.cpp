@@ -0,0 +1,150 @@
+/***************************************************************************
+ *   fheroes2: https://github.com/ihhub/fheroes2                           *
+ *   Copyright (C) 2026                                                    *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include "interface_terrain_cache.h"
+
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+
+#include "maps_tiles.h"
+#include "maps_tiles_render.h"
+#include "ui_constants.h"
+#include "world.h"
+
+namespace
+{
+    // Every chunk takes 512 x 512 pixels. This limit is enough to cover the whole game area on large screens and keep some chunks around it.
+    const size_t maxChunkCount{ 48 };
+
+    // Statistics of all caches for the debug information.
+    uint64_t cacheHitCount{ 0 };
+    uint64_t cacheMissCount{ 0 };
+    int32_t lastHitRatePercent{ -1 };
+}
+
+const fheroes2::Image & Interface::TerrainChunkCache::getChunk( const fheroes2::Point & chunkPos, const fheroes2::Rect & tileArea )
+{
+    if ( _worldWidth != world.w() || _worldHeight != world.h() ) {
+        clear();
+
+        _worldWidth = world.w();
+        _worldHeight = world.h();
+        _isTerrainLayerCached.resize( static_cast<size_t>( _worldWidth ) * _worldHeight, 0 );
+    }
+
+    Chunk & chunk = _getChunk( chunkPos );
+
+    const int32_t chunkWidth = chunk.image.width() / fheroes2::tileWidthPx;
+    const fheroes2::Point firstTile{ chunkPos.x * chunkSize, chunkPos.y * chunkSize };
+
+    const int32_t minX = std::max( tileArea.x, firstTile.x );
+    const int32_t minY = std::max( tileArea.y, firstTile.y );
+    const int32_t maxX = std::min( tileArea.x + tileArea.width, firstTile.x + chunkWidth );
+    const int32_t maxY = std::min( tileArea.y + tileArea.height, firstTile.y + chunk.image.height() / fheroes2::tileWidthPx );
+
+    for ( int32_t y = minY; y < maxY; ++y ) {
+        for ( int32_t x = minX; x < maxX; ++x ) {
+            const int32_t tileIndex = y * _worldWidth + x;
+            const Maps::Tile & tile = world.getTile( tileIndex );
+
+            uint64_t & signature = chunk.signatures[( y - firstTile.y ) * chunkWidth + x - firstTile.x];
+            const uint64_t newSignature = Maps::getStaticTerrainSignature( tile );
+
+            if ( signature == newSignature ) {
+                ++cacheHitCount;
+                continue;
+            }
+
+            ++cacheMissCount;
+
+            signature = newSignature;
+
+            const fheroes2::Point tilePos{ ( x - firstTile.x ) * fheroes2::tileWidthPx, ( y - firstTile.y ) * fheroes2::tileWidthPx };
+            _isTerrainLayerCached[tileIndex] = Maps::redrawStaticTerrain( tile, chunk.image, tilePos ) ? 1 : 0;
+        }
+    }
+
+    return chunk.image;
+}
+
+void Interface::TerrainChunkCache::clear()
+{
+    _chunks.clear();
+    _isTerrainLayerCached.clear();
+
+    _worldWidth = 0;
+    _worldHeight = 0;
+}
+
+int32_t Interface::TerrainChunkCache::getRecentHitRatePercent()
+{
+    const uint64_t total = cacheHitCount + cacheMissCount;
+    if ( total == 0 ) {
+        return lastHitRatePercent;
+    }
+
+    lastHitRatePercent = static_cast<int32_t>( cacheHitCount * 100 / total );
+
+    cacheHitCount = 0;
+    cacheMissCount = 0;
+
+    return lastHitRatePercent;
+}
+
+Interface::TerrainChunkCache::Chunk & Interface::TerrainChunkCache::_getChunk( const fheroes2::Point & chunkPos )
+{
+    assert( chunkPos.x >= 0 && chunkPos.x * chunkSize < _worldWidth && chunkPos.y >= 0 && chunkPos.y * chunkSize < _worldHeight );
+
+    ++_usageCounter;
+
+    auto iter = std::find_if( _chunks.begin(), _chunks.end(), [&chunkPos]( const Chunk & chunk ) { return chunk.position == chunkPos; } );
+    if ( iter != _chunks.end() ) {
+        iter->lastUsage = _usageCounter;
+        return *iter;
+    }
+
+    if ( _chunks.size() < maxChunkCount ) {
+        _chunks.emplace_back();
+        iter = std::prev( _chunks.end() );
+    }
+    else {
+        // Reuse the least recently used chunk.
+        iter = std::min_element( _chunks.begin(), _chunks.end(), []( const Chunk & first, const Chunk & second ) { return first.lastUsage < second.lastUsage; } );
+    }
+
+    Chunk & chunk = *iter;
+
+    // Chunks at the right and bottom borders of the world might be smaller.
+    const int32_t chunkWidth = std::min( chunkSize, _worldWidth - chunkPos.x * chunkSize );
+    const int32_t chunkHeight = std::min( chunkSize, _worldHeight - chunkPos.y * chunkSize );
+
+    chunk.position = chunkPos;
+    chunk.lastUsage = _usageCounter;
+    chunk.signatures.assign( static_cast<size_t>( chunkWidth ) * chunkHeight, 0 );
+
+    if ( chunk.image.width() != chunkWidth * fheroes2::tileWidthPx || chunk.image.height() != chunkHeight * fheroes2::tileWidthPx ) {
+        // Terrain images are opaque, so the transform layer is not needed. It must be disabled before the memory is allocated.
+        chunk.image._disableTransformLayer();
+        chunk.image.resize( chunkWidth * fheroes2::tileWidthPx, chunkHeight * fheroes2::tileWidthPx );
+    }
+
+    return chunk;
+}
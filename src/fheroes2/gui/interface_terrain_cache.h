@@ -0,0 +1,95 @@
+/***************************************************************************
+ *   fheroes2: https://github.com/ihhub/fheroes2                           *
+ *   Copyright (C) 2026                                                    *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "image.h"
+#include "math_base.h"
+
+namespace Interface
+{
+    // Cache of the pre-rendered adventure map terrain. Terrain images of tiles together with their roads, rivers and cracks are rendered
+    // into one image per block (chunk) of tiles, so the terrain of the visible area is drawn by a few copies of big images.
+    // Every tile of a chunk keeps the signature of what was rendered for it. A tile is rendered again only when its signature changes,
+    // this way any change of tiles (digging, editing the map, loading another map) is picked up without explicit notifications.
+    class TerrainChunkCache final
+    {
+    public:
+        // The size of a chunk side in tiles.
+        static constexpr int32_t chunkSize{ 16 };
+
+        TerrainChunkCache() = default;
+
+        // Game area copies are used only for one-time rendering, so a copy starts with an empty cache instead of duplicating all chunks.
+        TerrainChunkCache( const TerrainChunkCache & /* unused */ )
+        {
+            // Do nothing.
+        }
+
+        ~TerrainChunkCache() = default;
+
+        TerrainChunkCache & operator=( const TerrainChunkCache & ) = delete;
+
+        // Returns the image of the chunk with the given chunk coordinates. Tiles of the chunk within the given tile area are updated if they
+        // have been changed since the last time they were rendered. Tiles outside of this area might be outdated.
+        const fheroes2::Image & getChunk( const fheroes2::Point & chunkPos, const fheroes2::Rect & tileArea );
+
+        // Returns true if terrain layer objects of the tile are rendered in its chunk. Otherwise, they are animated and have to be rendered
+        // for every frame. This information is valid only for tiles updated by getChunk().
+        bool isTerrainLayerCached( const int32_t tileIndex ) const
+        {
+            return tileIndex >= 0 && static_cast<size_t>( tileIndex ) < _isTerrainLayerCached.size() && _isTerrainLayerCached[tileIndex] != 0;
+        }
+
+        void clear();
+
+        // Returns the percentage of tiles taken from all caches since the previous call of this method. If there were no requests since then,
+        // the previous result is returned. Returns -1 if the caches have never been used.
+        static int32_t getRecentHitRatePercent();
+
+    private:
+        struct Chunk
+        {
+            fheroes2::Point position{ -1, -1 };
+            fheroes2::Image image;
+
+            // Signatures of rendered tiles in the row-major order. Tiles which were never rendered have signature 0.
+            std::vector<uint64_t> signatures;
+
+            uint64_t lastUsage{ 0 };
+        };
+
+        Chunk & _getChunk( const fheroes2::Point & chunkPos );
+
+        std::vector<Chunk> _chunks;
+
+        // Terrain layer flags of every world tile, see isTerrainLayerCached().
+        std::vector<uint8_t> _isTerrainLayerCached;
+
+        int32_t _worldWidth{ 0 };
+        int32_t _worldHeight{ 0 };
+
+        uint64_t _usageCounter{ 0 };
+    };
+}
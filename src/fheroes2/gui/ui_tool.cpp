@@ -35,6 +35,7 @@
 #include "game_delays.h"
 #include "icn.h"
 #include "image_palette.h"
+#include "interface_terrain_cache.h"
 #include "localevent.h"
 #include "pal.h"
 #include "race.h"
@@ -296,6 +297,23 @@ namespace fheroes2
             info += std::to_string( static_cast<int32_t>( ( averageFps - integerFps ) * 10 ) );
         }
 
+        // Render time helps to evaluate the cost of the conversion of the frame into the screen format, especially for software rendering.
+        const int32_t renderTimeTenthsMs = static_cast<int32_t>( display.getAverageRenderTime() * 10 + 0.5 );
+
+        info += _( ", render: " );
+        info += std::to_string( renderTimeTenthsMs / 10 );
+        info += '.';
+        info += std::to_string( renderTimeTenthsMs % 10 );
+        info += _( " ms" );
+
+        // The terrain cache is used only to render the adventure map, so its hit rate is shown only after the adventure map has been shown.
+        const int32_t terrainCacheHitRate = Interface::TerrainChunkCache::getRecentHitRatePercent();
+        if ( terrainCacheHitRate >= 0 ) {
+            info += _( ", terrain cache: " );
+            info += std::to_string( terrainCacheHitRate );
+            info += '%';
+        }
+
         auto text = std::make_unique<fheroes2::Text>( std::move( info ), fheroes2::FontType::normalWhite() );
 
         fheroes2::Rect fpsRoi( text->area() );
@@ -197,7 +197,7 @@ namespace fheroes2
         bool _isSingleLineTextCenterAligned{ false };
     };
 
-    // Renderer of current time and FPS on screen
+    // Renderer of current time, FPS and frame render time on screen
     class SystemInfoRenderer
     {
     public:
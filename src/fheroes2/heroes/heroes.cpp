@@ -1402,6 +1402,50 @@ bool Heroes::isLosingGame() const
     return GetKingdom().isLosingGame();
 }
 
+bool Heroes::isAbleToPaySurrenderCost( const uint32_t cost ) const
+{
+    return GetKingdom().AllowPayment( { Resource::GOLD, cost } );
+}
+
+void Heroes::paySurrenderCost( const uint32_t cost, const PlayerColor receiverColor )
+{
+    const Funds payment( Resource::GOLD, cost );
+
+    GetKingdom().OddFundsResource( payment );
+    world.GetKingdom( receiverColor ).AddFundsResource( payment );
+}
+
+bool Heroes::isPossibleToReHireAfterBattle() const
+{
+    const Kingdom & kingdom = GetKingdom();
+
+    // If the hero is not the last in his kingdom, then we will assume that there is a possibility of re-hiring - even if there are no castles in the
+    // kingdom, one of the remaining heroes can capture an enemy castle
+    const VecHeroes & heroes = kingdom.GetHeroes();
+    if ( heroes.size() > 1 ) {
+        return true;
+    }
+
+    assert( heroes.size() == 1 && heroes.at( 0 ) == this );
+
+    // Otherwise, if this hero is the last one, and there are no castles in the kingdom, then it will be impossible to re-hire this hero
+    const VecCastles & castles = kingdom.GetCastles();
+    if ( castles.empty() ) {
+        return false;
+    }
+
+    // Otherwise, if this hero is defending the last castle, then it will be impossible to re-hire this hero
+    const Castle * castle = inCastle();
+    if ( castle && castles.size() == 1 ) {
+        assert( castles.at( 0 ) == castle );
+
+        return false;
+    }
+
+    // Otherwise, assume that there is a possibility of re-hiring
+    return true;
+}
+
 bool Heroes::PickupArtifact( const Artifact & art )
 {
     if ( !art.isValid() ) {
@@ -1808,7 +1852,7 @@ int Heroes::getNumOfTravelDays( const int32_t dstIdx ) const
     assert( Maps::isValidAbsIndex( dstIdx ) );
 
     const uint32_t maxMovePoints = GetMaxMovePoints();
-    const std::list<Route::Step> routePath = world.getPath( *this, dstIdx );
+    const std::vector<Route::Step> routePath = world.getPath( *this, dstIdx );
 
     if ( routePath.empty() ) {
         return 0;
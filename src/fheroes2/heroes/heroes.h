@@ -309,6 +309,11 @@ public:
     void Dismiss( const int reason );
 
     bool isLosingGame() const;
+
+    bool isAbleToPaySurrenderCost( const uint32_t cost ) const override;
+    void paySurrenderCost( const uint32_t cost, const PlayerColor receiverColor ) override;
+    bool isPossibleToReHireAfterBattle() const override;
+
     const Castle * inCastle() const override;
     Castle * inCastleMutable() const;
 
@@ -840,6 +845,11 @@ public:
         return Iterator( _heroes.end() );
     }
 
+    size_t size() const
+    {
+        return _heroes.size();
+    }
+
     void Init();
 
     void Clear()
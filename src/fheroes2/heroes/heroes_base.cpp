@@ -93,6 +93,22 @@ bool HeroBase::isHeroes() const
     return GetType() == HEROES;
 }
 
+bool HeroBase::isAbleToPaySurrenderCost( const uint32_t /* cost */ ) const
+{
+    return false;
+}
+
+void HeroBase::paySurrenderCost( const uint32_t /* cost */, const PlayerColor /* receiverColor */ )
+{
+    // Only heroes can surrender.
+    assert( 0 );
+}
+
+bool HeroBase::isPossibleToReHireAfterBattle() const
+{
+    return false;
+}
+
 bool HeroBase::isPotentSpellcaster() const
 {
     // With knowledge 5 or less there isn't enough spell points to make a difference
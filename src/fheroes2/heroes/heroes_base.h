@@ -107,6 +107,13 @@ public:
     virtual bool isCaptain() const;
     virtual bool isHeroes() const;
 
+    // Returns true if the kingdom of the commander is able to pay the given amount of gold to surrender in a battle.
+    virtual bool isAbleToPaySurrenderCost( const uint32_t cost ) const;
+    // Transfers the given amount of gold from the kingdom of the commander to the kingdom of the given color when surrendering in a battle.
+    virtual void paySurrenderCost( const uint32_t cost, const PlayerColor receiverColor );
+    // Returns true if the commander could be hired again after retreating or surrendering in a battle.
+    virtual bool isPossibleToReHireAfterBattle() const;
+
     int GetAttackModificator( std::string * = nullptr ) const;
     int GetDefenseModificator( std::string * = nullptr ) const;
     int GetPowerModificator( std::string * = nullptr ) const;
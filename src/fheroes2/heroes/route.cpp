@@ -384,7 +384,7 @@ OStreamBase & Route::operator<<( OStreamBase & stream, const Step & step )
 
 OStreamBase & Route::operator<<( OStreamBase & stream, const Path & path )
 {
-    return stream << path._hide << static_cast<const std::list<Step> &>( path );
+    return stream << path._hide << static_cast<const std::vector<Step> &>( path );
 }
 
 IStreamBase & Route::operator>>( IStreamBase & stream, Step & step )
@@ -396,7 +396,7 @@ IStreamBase & Route::operator>>( IStreamBase & stream, Step & step )
 
 IStreamBase & Route::operator>>( IStreamBase & stream, Path & path )
 {
-    std::list<Step> & base = path;
+    std::vector<Step> & base = path;
 
     static_assert( LAST_SUPPORTED_FORMAT_VERSION < FORMAT_VERSION_1007_RELEASE, "Remove the logic below." );
     if ( Game::GetVersionOfCurrentSaveFile() < FORMAT_VERSION_1007_RELEASE ) {
@@ -408,7 +408,7 @@ IStreamBase & Route::operator>>( IStreamBase & stream, Path & path )
     return stream >> path._hide >> base;
 }
 
-uint32_t Route::calculatePathPenalty( const std::list<Step> & path )
+uint32_t Route::calculatePathPenalty( const std::vector<Step> & path )
 {
     return std::accumulate( path.begin(), path.end(), static_cast<uint32_t>( 0 ), []( const uint32_t total, const Step & step ) { return total + step.GetPenalty(); } );
 }
@@ -24,8 +24,8 @@
 #pragma once
 
 #include <cstdint>
-#include <list>
 #include <string>
+#include <vector>
 
 #include "direction.h"
 
@@ -77,7 +77,9 @@ namespace Route
         uint32_t penalty = 0;
     };
 
-    class Path : public std::list<Step>
+    // Steps are stored contiguously as paths are built and thrown away very often (especially by AI) while removing the current
+    // step happens only once per hero movement and paths are short enough for it to be cheap.
+    class Path : public std::vector<Step>
     {
     public:
         explicit Path( const Heroes & hero );
@@ -124,12 +126,10 @@ namespace Route
                 return Direction::UNKNOWN;
             }
 
-            auto iter = cbegin();
-
-            return ( ++iter )->GetDirection();
+            return ( *this )[1].GetDirection();
         }
 
-        void setPath( const std::list<Step> & path )
+        void setPath( const std::vector<Step> & path )
         {
             assign( path.begin(), path.end() );
         }
@@ -156,9 +156,7 @@ namespace Route
                 return;
             }
 
-            auto iter = cbegin();
-
-            erase( ++iter, cend() );
+            erase( cbegin() + 1, cend() );
         }
 
         void PopFront()
@@ -167,7 +165,7 @@ namespace Route
                 return;
             }
 
-            pop_front();
+            erase( begin() );
         }
 
         // Returns true if this path is valid for normal movement on the map (the current step is performed to the tile
@@ -204,5 +202,5 @@ namespace Route
     OStreamBase & operator<<( OStreamBase & stream, const Path & path );
     IStreamBase & operator>>( IStreamBase & stream, Path & path );
 
-    uint32_t calculatePathPenalty( const std::list<Step> & path );
+    uint32_t calculatePathPenalty( const std::vector<Step> & path );
 }
@@ -25,6 +25,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <functional>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -131,6 +132,8 @@ void Kingdom::clear()
     heroes.clear();
     castles.clear();
     visit_object.clear();
+    _lastVisitedObjectTypes.clear();
+    _visitedObjectCounts.clear();
 
     recruits.Reset();
 
@@ -197,6 +200,7 @@ void Kingdom::ActionNewDay()
 {
     // Clear the visited objects with a lifetime of one day, even if this kingdom has already been vanquished
     visit_object.remove_if( Visit::isDayLife );
+    _updateVisitedObjectsLookup();
 
     if ( !isPlay() ) {
         return;
@@ -245,6 +249,7 @@ void Kingdom::ActionNewWeek()
 {
     // Clear the visited objects with a lifetime of one week, even if this kingdom has already been vanquished
     visit_object.remove_if( Visit::isWeekLife );
+    _updateVisitedObjectsLookup();
 
     if ( !isPlay() ) {
         return;
@@ -392,25 +397,69 @@ bool Kingdom::isVisited( const Maps::Tile & tile ) const
 
 bool Kingdom::isVisited( int32_t index, const MP2::MapObjectType objectType ) const
 {
-    std::list<IndexObject>::const_iterator it = std::find_if( visit_object.begin(), visit_object.end(), [index]( const IndexObject & v ) { return v.isIndex( index ); } );
-    return visit_object.end() != it && ( *it ).isObject( objectType );
+    if ( objectType == MP2::OBJ_NONE || index < 0 || static_cast<size_t>( index ) >= _lastVisitedObjectTypes.size() ) {
+        return false;
+    }
+
+    return _lastVisitedObjectTypes[index] == objectType;
 }
 
 bool Kingdom::isVisited( const MP2::MapObjectType objectType ) const
 {
-    return std::any_of( visit_object.begin(), visit_object.end(), [objectType]( const IndexObject & v ) { return v.isObject( objectType ); } );
+    return CountVisitedObjects( objectType ) > 0;
 }
 
 uint32_t Kingdom::CountVisitedObjects( const MP2::MapObjectType objectType ) const
 {
-    // Safe to downcast as we don't deal with gigantic amount of data.
-    return static_cast<uint32_t>( std::count_if( visit_object.begin(), visit_object.end(), [objectType]( const IndexObject & v ) { return v.isObject( objectType ); } ) );
+    if ( objectType >= _visitedObjectCounts.size() ) {
+        return 0;
+    }
+
+    return _visitedObjectCounts[objectType];
 }
 
 void Kingdom::SetVisited( int32_t index, const MP2::MapObjectType objectType )
 {
-    if ( !isVisited( index, objectType ) && objectType != MP2::OBJ_NONE )
-        visit_object.emplace_front( index, objectType );
+    if ( objectType == MP2::OBJ_NONE || index < 0 || isVisited( index, objectType ) ) {
+        return;
+    }
+
+    visit_object.emplace_front( index, objectType );
+    _addVisitedObjectToLookup( index, objectType );
+}
+
+void Kingdom::_updateVisitedObjectsLookup()
+{
+    _lastVisitedObjectTypes.assign( _lastVisitedObjectTypes.size(), MP2::OBJ_NONE );
+    _visitedObjectCounts.assign( _visitedObjectCounts.size(), 0 );
+
+    // The list starts from the most recently visited object, so it is processed backwards for the most recent object of a tile to be the last one set.
+    for ( auto iter = visit_object.rbegin(); iter != visit_object.rend(); ++iter ) {
+        if ( iter->first < 0 || iter->second == MP2::OBJ_NONE ) {
+            // SetVisited() never adds such entries, they could only come from a corrupted save file.
+            continue;
+        }
+
+        _addVisitedObjectToLookup( iter->first, iter->second );
+    }
+}
+
+void Kingdom::_addVisitedObjectToLookup( const int32_t index, const MP2::MapObjectType objectType )
+{
+    assert( index >= 0 && objectType != MP2::OBJ_NONE );
+
+    if ( static_cast<size_t>( index ) >= _lastVisitedObjectTypes.size() ) {
+        // The lookup data is usually created before the world is loaded, so its size is taken from the visited objects themselves.
+        _lastVisitedObjectTypes.resize( std::max( static_cast<size_t>( index ) + 1, world.getSize() ), MP2::OBJ_NONE );
+    }
+
+    _lastVisitedObjectTypes[index] = objectType;
+
+    if ( objectType >= _visitedObjectCounts.size() ) {
+        _visitedObjectCounts.resize( static_cast<size_t>( objectType ) + 1, 0 );
+    }
+
+    ++_visitedObjectCounts[objectType];
 }
 
 bool Kingdom::opponentsCanRecruitMoreHeroes() const
@@ -920,6 +969,8 @@ IStreamBase & operator>>( IStreamBase & stream, Kingdom & kingdom )
     stream >> kingdom.resource >> kingdom.lost_town_days >> kingdom.castles >> kingdom.heroes >> kingdom.recruits >> kingdom.visit_object >> kingdom.puzzle_maps
         >> kingdom._visitedTentsColors;
 
+    kingdom._updateVisitedObjectsLookup();
+
     static_assert( LAST_SUPPORTED_FORMAT_VERSION < FORMAT_VERSION_PRE2_1100_RELEASE, "Remove the logic below." );
     if ( Game::GetVersionOfCurrentSaveFile() < FORMAT_VERSION_PRE2_1100_RELEASE ) {
         int32_t dummy;
@@ -930,9 +981,24 @@ IStreamBase & operator>>( IStreamBase & stream, Kingdom & kingdom )
     return stream >> kingdom._topCastleInKingdomView >> kingdom._topHeroInKingdomView;
 }
 
+void Kingdoms::serialize( OStreamBase & stream, const std::function<void()> & onKingdomStart ) const
+{
+    stream.put32( static_cast<uint32_t>( _kingdoms.size() ) );
+
+    for ( const Kingdom & kingdom : _kingdoms ) {
+        if ( onKingdomStart ) {
+            onKingdomStart();
+        }
+
+        stream << kingdom;
+    }
+}
+
 OStreamBase & operator<<( OStreamBase & stream, const Kingdoms & obj )
 {
-    return stream << obj._kingdoms;
+    obj.serialize( stream, {} );
+
+    return stream;
 }
 
 IStreamBase & operator>>( IStreamBase & stream, Kingdoms & obj )
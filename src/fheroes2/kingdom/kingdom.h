@@ -29,6 +29,7 @@
 #include <functional>
 #include <list>
 #include <set>
+#include <vector>
 
 #include "bitmodes.h"
 #include "castle.h"
@@ -241,6 +242,11 @@ public:
 private:
     Cost _getKingdomStartingResources( const int difficulty ) const;
 
+    // Rebuilds the lookup data of visited objects from scratch after objects have been removed from the list or the list has been loaded.
+    void _updateVisitedObjectsLookup();
+
+    void _addVisitedObjectToLookup( const int32_t index, const MP2::MapObjectType objectType );
+
     friend OStreamBase & operator<<( OStreamBase & stream, const Kingdom & kingdom );
     friend IStreamBase & operator>>( IStreamBase & stream, Kingdom & kingdom );
 
@@ -254,8 +260,14 @@ private:
 
     Recruits recruits;
 
+    // Visited objects starting from the most recently visited one. Only this list is saved, the lookup data below is derived from it.
     std::list<IndexObject> visit_object;
 
+    // The type of the most recently visited object for every tile index, OBJ_NONE if nothing was visited on the tile.
+    std::vector<MP2::MapObjectType> _lastVisitedObjectTypes;
+    // The number of visited objects for every object type.
+    std::vector<uint32_t> _visitedObjectCounts;
+
     Puzzle puzzle_maps;
     int32_t _visitedTentsColors{ 0 };
 
@@ -290,6 +302,9 @@ public:
     // in the kingdoms
     std::set<Heroes *> resetRecruits();
 
+    // Serializes the kingdoms in the same way as operator<< does, calling the given function (if set) before every kingdom.
+    void serialize( OStreamBase & stream, const std::function<void()> & onKingdomStart ) const;
+
 private:
     friend OStreamBase & operator<<( OStreamBase & stream, const Kingdoms & obj );
     friend IStreamBase & operator>>( IStreamBase & stream, Kingdoms & obj );
@@ -46,6 +46,16 @@ namespace Maps::Map_Format
         ObjectGroup group{ ObjectGroup::NONE };
 
         uint32_t index{ 0 };
+
+        bool operator==( const TileObjectInfo & anotherInfo ) const
+        {
+            return id == anotherInfo.id && group == anotherInfo.group && index == anotherInfo.index;
+        }
+
+        bool operator!=( const TileObjectInfo & anotherInfo ) const
+        {
+            return !( *this == anotherInfo );
+        }
     };
 
     struct TileInfo
@@ -54,6 +64,16 @@ namespace Maps::Map_Format
         uint8_t terrainFlags{ 0 };
 
         std::vector<TileObjectInfo> objects;
+
+        bool operator==( const TileInfo & anotherInfo ) const
+        {
+            return terrainIndex == anotherInfo.terrainIndex && terrainFlags == anotherInfo.terrainFlags && objects == anotherInfo.objects;
+        }
+
+        bool operator!=( const TileInfo & anotherInfo ) const
+        {
+            return !( *this == anotherInfo );
+        }
     };
 
     constexpr size_t messageCharLimit{ 999 };
@@ -202,6 +222,16 @@ namespace Maps::Map_Format
     struct SignMetadata
     {
         std::string message;
+
+        bool operator==( const SignMetadata & anotherMetadata ) const
+        {
+            return message == anotherMetadata.message;
+        }
+
+        bool operator!=( const SignMetadata & anotherMetadata ) const
+        {
+            return !( *this == anotherMetadata );
+        }
     };
 
     struct AdventureMapEventMetadata
@@ -256,11 +286,31 @@ namespace Maps::Map_Format
     struct SelectionObjectMetadata
     {
         std::vector<int32_t> selectedItems;
+
+        bool operator==( const SelectionObjectMetadata & anotherMetadata ) const
+        {
+            return selectedItems == anotherMetadata.selectedItems;
+        }
+
+        bool operator!=( const SelectionObjectMetadata & anotherMetadata ) const
+        {
+            return !( *this == anotherMetadata );
+        }
     };
 
     struct CapturableObjectMetadata
     {
         PlayerColor ownerColor{ 0 };
+
+        bool operator==( const CapturableObjectMetadata & anotherMetadata ) const
+        {
+            return ownerColor == anotherMetadata.ownerColor;
+        }
+
+        bool operator!=( const CapturableObjectMetadata & anotherMetadata ) const
+        {
+            return !( *this == anotherMetadata );
+        }
     };
 
     struct MonsterMetadata
@@ -275,6 +325,17 @@ namespace Maps::Map_Format
 
         // Only for random monsters.
         std::vector<int32_t> selected;
+
+        bool operator==( const MonsterMetadata & anotherMetadata ) const
+        {
+            return count == anotherMetadata.count && joinCondition == anotherMetadata.joinCondition
+                   && isWeeklyGrowthDisabled == anotherMetadata.isWeeklyGrowthDisabled && selected == anotherMetadata.selected;
+        }
+
+        bool operator!=( const MonsterMetadata & anotherMetadata ) const
+        {
+            return !( *this == anotherMetadata );
+        }
     };
 
     struct ArtifactMetadata
@@ -287,11 +348,31 @@ namespace Maps::Map_Format
 
         // Only for random artifacts and Scroll Spell.
         std::vector<int32_t> selected;
+
+        bool operator==( const ArtifactMetadata & anotherMetadata ) const
+        {
+            return radius == anotherMetadata.radius && captureCondition == anotherMetadata.captureCondition && selected == anotherMetadata.selected;
+        }
+
+        bool operator!=( const ArtifactMetadata & anotherMetadata ) const
+        {
+            return !( *this == anotherMetadata );
+        }
     };
 
     struct ResourceMetadata
     {
         int32_t count{ 0 };
+
+        bool operator==( const ResourceMetadata & anotherMetadata ) const
+        {
+            return count == anotherMetadata.count;
+        }
+
+        bool operator!=( const ResourceMetadata & anotherMetadata ) const
+        {
+            return !( *this == anotherMetadata );
+        }
     };
 
     struct DailyEvent
@@ -386,6 +467,8 @@ namespace Maps::Map_Format
         std::map<fheroes2::SupportedLanguage, TranslationBaseMapMetadata> translations;
     };
 
+    // Editor undo history (see history_manager.cpp) relies on the list of members of this structure.
+    // Update it when adding new members.
     struct MapFormat final : public BaseMapFormat
     {
         // This is used only for campaign maps.
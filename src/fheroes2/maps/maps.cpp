@@ -24,11 +24,14 @@
 #include "maps.h"
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <cmath>
+#include <cstddef>
 #include <cstdlib>
 #include <functional>
 #include <ostream>
+#include <vector>
 
 #include "ai_planner.h"
 #include "army.h"
@@ -48,6 +51,8 @@
 #include "settings.h"
 #include "translations.h"
 #include "world.h"
+#include "world_fog.h"
+#include "world_object_index.h"
 
 namespace
 {
@@ -62,15 +67,70 @@ namespace
         return result;
     }
 
+    // Heroes hide objects they stand on, so the tiles with such objects are not present in the object index under the type of the object.
+    // This function adds such tiles to the given sorted list of tiles keeping it sorted.
+    void addObjectsUnderHeroes( const Maps::Indexes & heroTiles, const MP2::MapObjectType objectType, Maps::Indexes & result )
+    {
+        const size_t objectCount = result.size();
+
+        for ( const int32_t tileIndex : heroTiles ) {
+            if ( world.getTile( tileIndex ).getMainObjectType( false ) == objectType ) {
+                result.push_back( tileIndex );
+            }
+        }
+
+        if ( result.size() != objectCount ) {
+            std::inplace_merge( result.begin(), result.begin() + static_cast<std::ptrdiff_t>( objectCount ), result.end() );
+        }
+    }
+
     Maps::Indexes MapsIndexesObject( const MP2::MapObjectType objectType, const bool ignoreHeroes )
     {
         Maps::Indexes result;
-        const int32_t size = static_cast<int32_t>( world.getSize() );
-        for ( int32_t idx = 0; idx < size; ++idx ) {
-            if ( world.getTile( idx ).getMainObjectType( !ignoreHeroes ) == objectType ) {
-                result.push_back( idx );
+
+        if ( objectType == MP2::OBJ_NONE ) {
+            // Empty tiles are not indexed.
+            const int32_t size = static_cast<int32_t>( world.getSize() );
+            for ( int32_t idx = 0; idx < size; ++idx ) {
+                if ( world.getTile( idx ).getMainObjectType( !ignoreHeroes ) == objectType ) {
+                    result.push_back( idx );
+                }
             }
+            return result;
+        }
+
+        const WorldObjectIndex & objectIndex = world.getObjectIndex();
+
+        if ( !ignoreHeroes ) {
+            return objectIndex.getObjectTiles( objectType );
+        }
+
+        if ( objectType != MP2::OBJ_HERO ) {
+            result = objectIndex.getObjectTiles( objectType );
+        }
+
+        addObjectsUnderHeroes( objectIndex.getObjectTiles( MP2::OBJ_HERO ), objectType, result );
+
+        return result;
+    }
+
+    Maps::Indexes MapsIndexesObjectAround( const int32_t center, const int32_t distance, const MP2::MapObjectType objectType )
+    {
+        if ( objectType == MP2::OBJ_NONE ) {
+            // Empty tiles are not indexed.
+            return MapsIndexesFilteredObject( Maps::getAroundIndexes( center, distance ), objectType );
         }
+
+        const WorldObjectIndex & objectIndex = world.getObjectIndex();
+
+        Maps::Indexes result;
+
+        if ( objectType != MP2::OBJ_HERO ) {
+            result = objectIndex.getObjectTilesAround( center, distance, objectType, world.w(), world.h() );
+        }
+
+        addObjectsUnderHeroes( objectIndex.getObjectTilesAround( center, distance, MP2::OBJ_HERO, world.w(), world.h() ), objectType, result );
+
         return result;
     }
 
@@ -97,6 +157,76 @@ namespace
         return squaredDistanceLimit;
     }
 
+    // Returns the half widths of the scouting circle rows from the top row to the bottom one. A negative half width means that the row is empty.
+    std::vector<int32_t> getScoutingCircleHalfWidths( const int32_t scoutingDistance )
+    {
+        const int32_t squaredScoutingRadiusLimit = getSquaredScoutingRadiusLimit( scoutingDistance );
+
+        std::vector<int32_t> halfWidths;
+        halfWidths.reserve( static_cast<size_t>( scoutingDistance ) * 2 + 1 );
+
+        for ( int32_t dy = -scoutingDistance; dy <= scoutingDistance; ++dy ) {
+            int32_t halfWidth = scoutingDistance;
+            while ( halfWidth >= 0 && halfWidth * halfWidth + dy * dy >= squaredScoutingRadiusLimit ) {
+                --halfWidth;
+            }
+
+            halfWidths.push_back( halfWidth );
+        }
+
+        return halfWidths;
+    }
+
+    // Calls function( firstTileIndex, lastTileIndex ) for every row of the scouting circle around the given tile clipped by the map borders.
+    template <typename Function>
+    void forEachScoutingCircleRow( const int32_t tileIndex, const int32_t scoutingDistance, Function function )
+    {
+        // Scouting distances used by the game are small, so their circles are computed only once. Larger distances (which are only possible
+        // with lots of artifacts) are computed on the fly.
+        static constexpr int32_t maxPrecomputedDistance{ 32 };
+
+        static const std::array<std::vector<int32_t>, maxPrecomputedDistance + 1> precomputedHalfWidths = []() {
+            std::array<std::vector<int32_t>, maxPrecomputedDistance + 1> result;
+            for ( int32_t distance = 1; distance <= maxPrecomputedDistance; ++distance ) {
+                result[distance] = getScoutingCircleHalfWidths( distance );
+            }
+
+            return result;
+        }();
+
+        assert( scoutingDistance > 0 );
+
+        std::vector<int32_t> computedHalfWidths;
+        if ( scoutingDistance > maxPrecomputedDistance ) {
+            computedHalfWidths = getScoutingCircleHalfWidths( scoutingDistance );
+        }
+
+        const std::vector<int32_t> & halfWidths = ( scoutingDistance > maxPrecomputedDistance ) ? computedHalfWidths : precomputedHalfWidths[scoutingDistance];
+
+        const fheroes2::Point center = Maps::GetPoint( tileIndex );
+        const int32_t worldWidth = world.w();
+
+        const int32_t minY = std::max<int32_t>( center.y - scoutingDistance, 0 );
+        const int32_t maxY = std::min<int32_t>( center.y + scoutingDistance, world.h() - 1 );
+        assert( minY < maxY );
+
+        for ( int32_t y = minY; y <= maxY; ++y ) {
+            const int32_t halfWidth = halfWidths[y - center.y + scoutingDistance];
+            if ( halfWidth < 0 ) {
+                continue;
+            }
+
+            const int32_t minX = std::max<int32_t>( center.x - halfWidth, 0 );
+            const int32_t maxX = std::min<int32_t>( center.x + halfWidth, worldWidth - 1 );
+            if ( minX > maxX ) {
+                continue;
+            }
+
+            const int32_t offset = y * worldWidth;
+            function( offset + minX, offset + maxX );
+        }
+    }
+
     void forEachMonsterProtectingTile( const int32_t tileIndex, const std::function<void( const int32_t )> & lambda )
     {
         const int width = world.w();
@@ -463,7 +593,7 @@ MapsIndexes Maps::getVisibleMonstersAroundHero( const Heroes & hero )
 
 void Maps::ClearFog( const int32_t tileIndex, const int32_t scoutingDistance, const PlayerColor playerColor )
 {
-    if ( scoutingDistance <= 0 || !Maps::isValidAbsIndex( tileIndex ) ) {
+    if ( scoutingDistance <= 0 || !Maps::isValidAbsIndex( tileIndex ) || ( static_cast<PlayerColorsSet>( playerColor ) & Color::allPlayerColors() ) == 0 ) {
         // Nothing to uncover.
         return;
     }
@@ -474,50 +604,40 @@ void Maps::ClearFog( const int32_t tileIndex, const int32_t scoutingDistance, co
     const bool isHumanOrHumanFriend = !isAIPlayer || Players::isFriends( playerColor, Players::HumanColors() )
                                       || ( Settings::Get().IsGameType( Game::TYPE_AUTO_PLAYTEST ) && fheroes2::AutoPlaytest::instance().isAnimationEnabled() );
 
-    const fheroes2::Point center = Maps::GetPoint( tileIndex );
-    const int32_t squaredScoutingRadiusLimit = getSquaredScoutingRadiusLimit( scoutingDistance );
     const PlayerColorsSet alliedColors = Players::GetPlayerFriends( playerColor );
-
-    const int32_t minY = std::max<int32_t>( center.y - scoutingDistance, 0 );
-    const int32_t maxY = std::min<int32_t>( center.y + scoutingDistance, world.h() - 1 );
-    assert( minY < maxY );
-
+    const WorldFog & fog = world.getFog();
     const int32_t worldWidth = world.w();
-    const int32_t minX = std::max<int32_t>( center.x - scoutingDistance, 0 );
-    const int32_t maxX = std::min<int32_t>( center.x + scoutingDistance, worldWidth - 1 );
-    assert( minX < maxX );
 
     fheroes2::Point fogRevealMinPos( world.h(), worldWidth );
     fheroes2::Point fogRevealMaxPos( 0, 0 );
 
-    for ( int32_t y = minY; y <= maxY; ++y ) {
-        const int32_t dy = y - center.y;
-        const int32_t dySquared = dy * dy;
-        const int32_t offset = y * worldWidth;
-
-        for ( int32_t x = minX; x <= maxX; ++x ) {
-            const int32_t dx = x - center.x;
-            if ( dx * dx + dySquared < squaredScoutingRadiusLimit ) {
-                Maps::Tile & tile = world.getTile( x + offset );
-                if ( isAIPlayer && tile.isFog( playerColor ) ) {
-                    AI::Planner::Get().revealFog( tile, kingdom );
-                }
+    forEachScoutingCircleRow( tileIndex, scoutingDistance, [&]( const int32_t firstTileIndex, const int32_t lastTileIndex ) {
+        // Fog of allied colors can be cleared only on tiles which are covered by fog for the player, so other tiles are skipped word by word.
+        fog.forEachFogTile( firstTileIndex, lastTileIndex, static_cast<PlayerColorsSet>( playerColor ), [&]( const int32_t index ) {
+            Maps::Tile & tile = world.getTile( index );
+            if ( isAIPlayer ) {
+                AI::Planner::Get().revealFog( tile, kingdom );
+            }
 
-                if ( tile.isFog( alliedColors ) ) {
-                    // Clear fog only if it is not already cleared.
-                    tile.ClearFog( alliedColors );
-
-                    if ( isHumanOrHumanFriend ) {
-                        // Update fog reveal area points only for human player and his allies.
-                        fogRevealMinPos.x = std::min( fogRevealMinPos.x, x );
-                        fogRevealMinPos.y = std::min( fogRevealMinPos.y, y );
-                        fogRevealMaxPos.x = std::max( fogRevealMaxPos.x, x );
-                        fogRevealMaxPos.y = std::max( fogRevealMaxPos.y, y );
-                    }
-                }
+            if ( !fog.isFog( index, alliedColors ) ) {
+                // Fog is already cleared.
+                return;
             }
-        }
-    }
+
+            tile.ClearFog( alliedColors );
+
+            if ( isHumanOrHumanFriend ) {
+                // Update fog reveal area points only for human player and his allies.
+                const int32_t x = index % worldWidth;
+                const int32_t y = index / worldWidth;
+
+                fogRevealMinPos.x = std::min( fogRevealMinPos.x, x );
+                fogRevealMinPos.y = std::min( fogRevealMinPos.y, y );
+                fogRevealMaxPos.x = std::max( fogRevealMaxPos.x, x );
+                fogRevealMaxPos.y = std::max( fogRevealMaxPos.y, y );
+            }
+        } );
+    } );
 
     // Update fog directions only for human player and his allies and only if fog has to be cleared.
     if ( isHumanOrHumanFriend && ( fogRevealMaxPos.x >= fogRevealMinPos.x ) && ( fogRevealMaxPos.y >= fogRevealMinPos.y ) ) {
@@ -534,35 +654,13 @@ int32_t Maps::getFogTileCountToBeRevealed( const int32_t tileIndex, const int32_
         return 0;
     }
 
-    const fheroes2::Point center = Maps::GetPoint( tileIndex );
-    const int32_t squaredScoutingRadiusLimit = getSquaredScoutingRadiusLimit( scoutingDistance );
-
-    const int32_t minY = std::max<int32_t>( center.y - scoutingDistance, 0 );
-    const int32_t maxY = std::min<int32_t>( center.y + scoutingDistance, world.h() - 1 );
-    assert( minY < maxY );
-
-    const int32_t worldWidth = world.w();
-    const int32_t minX = std::max<int32_t>( center.x - scoutingDistance, 0 );
-    const int32_t maxX = std::min<int32_t>( center.x + scoutingDistance, worldWidth - 1 );
-    assert( minX < maxX );
+    const WorldFog & fog = world.getFog();
 
     int32_t tileCount = 0;
 
-    for ( int32_t y = minY; y <= maxY; ++y ) {
-        const int32_t dy = y - center.y;
-        const int32_t dySquared = dy * dy;
-        const int32_t offset = y * worldWidth;
-
-        for ( int32_t x = minX; x <= maxX; ++x ) {
-            const int32_t dx = x - center.x;
-            if ( dx * dx + dySquared < squaredScoutingRadiusLimit ) {
-                const Maps::Tile & tile = world.getTile( x + offset );
-                if ( tile.isFog( playerColor ) ) {
-                    ++tileCount;
-                }
-            }
-        }
-    }
+    forEachScoutingCircleRow( tileIndex, scoutingDistance, [&fog, &tileCount, playerColor]( const int32_t firstTileIndex, const int32_t lastTileIndex ) {
+        tileCount += fog.countFog( firstTileIndex, lastTileIndex, playerColor );
+    } );
 
     return tileCount;
 }
@@ -587,27 +685,20 @@ bool Maps::isValidForDimensionDoor( int32_t targetIndex, bool isWater )
 
 Maps::Indexes Maps::ScanAroundObject( const int32_t center, const MP2::MapObjectType objectType )
 {
-    const Indexes results = getAroundIndexes( center );
-    return MapsIndexesFilteredObject( results, objectType );
+    return MapsIndexesObjectAround( center, 1, objectType );
 }
 
 Maps::Indexes Maps::ScanAroundObjectWithDistance( const int32_t center, const uint32_t dist, const MP2::MapObjectType objectType )
 {
-    Indexes results = getAroundIndexes( center, dist );
-    std::sort( results.begin(), results.end(), ComparisonDistance( center ) );
-    return MapsIndexesFilteredObject( results, objectType );
+    Indexes results = MapsIndexesObjectAround( center, static_cast<int32_t>( dist ), objectType );
+    // Tiles at the same distance keep their order to make the result independent of the sorting implementation.
+    std::stable_sort( results.begin(), results.end(), ComparisonDistance( center ) );
+    return results;
 }
 
 bool Maps::doesObjectExistOnMap( const MP2::MapObjectType objectType )
 {
-    const int32_t size = static_cast<int32_t>( world.getSize() );
-    for ( int32_t idx = 0; idx < size; ++idx ) {
-        if ( world.getTile( idx ).getMainObjectType( false ) == objectType ) {
-            return true;
-        }
-    }
-
-    return false;
+    return !MapsIndexesObject( objectType, true ).empty();
 }
 
 Maps::Indexes Maps::GetObjectPositions( const MP2::MapObjectType objectType )
@@ -643,8 +734,9 @@ bool Maps::isTileUnderProtection( const int32_t tileIndex )
 
 bool Maps::isTileProtectionStrongerThan( const int32_t tileIndex, const double armyStrength )
 {
-    // Creating an Army instance is a relatively heavy operation, so cache it to speed up calculations
-    static Army tileArmy;
+    // Creating an Army instance is a relatively heavy operation, so cache it to speed up calculations. This function can be
+    // called by several AI threads at the same time, so every thread has its own instance.
+    thread_local Army tileArmy;
     bool isStronger = false;
 
     forEachMonsterProtectingTile( tileIndex, [&armyStrength, &isStronger]( const int32_t monsterIndex ) {
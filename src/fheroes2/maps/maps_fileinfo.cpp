@@ -31,6 +31,7 @@
 #include <list>
 #include <map>
 #include <sstream>
+#include <thread>
 #include <type_traits>
 #include <utility>
 
@@ -51,6 +52,7 @@
 #include "serialize.h"
 #include "settings.h"
 #include "system.h"
+#include "thread.h"
 #include "tools.h"
 #include "ui_font.h"
 #include "ui_language.h"
@@ -60,15 +62,289 @@ namespace
     const size_t mapNameLength = 16;
     const size_t mapDescriptionLength = 200;
 
-    // This function returns an unsorted array. It is a caller responsibility to take care of sorting if needed.
-    MapsFileInfoList getValidMaps( const ListFiles & mapFiles, const uint8_t humanPlayerCount, const bool isOriginalMapFormat )
+    // Headers of map files are stored in the catalogue file so map files do not need to be read every time the list of maps is shown.
+    // The catalogue must be invalidated by increasing its version every time the map file reading logic or the FileInfo structure changes.
+    const uint32_t mapCatalogueMagicValue = 0x4D415043;
+    const uint16_t mapCatalogueVersion = 1;
+    const char * mapCatalogueFileName = "maps.cache";
+
+    const size_t maxMapReaderThreadCount{ 16 };
+
+    // Map files are identified by the path and the purpose of reading.
+    using MapCatalogueKey = std::pair<std::string, bool>;
+
+    struct MapCatalogueEntry
     {
-        assert( humanPlayerCount >= 1 );
+        uint64_t fileSize{ 0 };
+        int64_t modificationTime{ 0 };
+
+        // Texts of Resurrection maps loaded for the game depend on the language.
+        fheroes2::SupportedLanguage language{ fheroes2::SupportedLanguage::English };
+
+        // The map file could be invalid. Such files are stored as well to avoid reading them again.
+        bool isValid{ false };
+
+        Maps::FileInfo info;
+
+        // Entries of files which have not been found during the current run of the game are removed from the catalogue.
+        bool isUsed{ false };
+    };
+
+    void writeUint64( OStreamBase & stream, const uint64_t value )
+    {
+        stream << static_cast<uint32_t>( value >> 32 ) << static_cast<uint32_t>( value & 0xFFFFFFFF );
+    }
+
+    uint64_t readUint64( IStreamBase & stream )
+    {
+        uint32_t high = 0;
+        uint32_t low = 0;
+        stream >> high >> low;
+
+        return ( static_cast<uint64_t>( high ) << 32 ) | low;
+    }
+
+    class MapCatalogue
+    {
+    public:
+        MapCatalogue()
+            : _filePath( System::concatPath( System::GetDataDirectory( "fheroes2" ), mapCatalogueFileName ) )
+        {
+            _load();
+        }
+
+        MapCatalogue( const MapCatalogue & ) = delete;
+        MapCatalogue & operator=( const MapCatalogue & ) = delete;
+
+        ~MapCatalogue() = default;
+
+        // Returns nullptr if the map file has been changed since the time the entry was stored.
+        MapCatalogueEntry * find( const MapCatalogueKey & key, const uint64_t fileSize, const int64_t modificationTime, const fheroes2::SupportedLanguage language )
+        {
+            const auto iter = _entries.find( key );
+            if ( iter == _entries.end() ) {
+                return nullptr;
+            }
+
+            MapCatalogueEntry & entry = iter->second;
+            if ( entry.fileSize != fileSize || entry.modificationTime != modificationTime || entry.language != language ) {
+                return nullptr;
+            }
+
+            entry.isUsed = true;
+
+            return &entry;
+        }
+
+        void update( const MapCatalogueKey & key, MapCatalogueEntry && entry )
+        {
+            entry.isUsed = true;
+
+            _entries[key] = std::move( entry );
+            _isModified = true;
+        }
+
+        void save()
+        {
+            if ( !_isModified ) {
+                return;
+            }
+
+            for ( auto iter = _entries.begin(); iter != _entries.end(); ) {
+                if ( !iter->second.isUsed && !System::IsFile( iter->first.first ) ) {
+                    iter = _entries.erase( iter );
+                }
+                else {
+                    ++iter;
+                }
+            }
+
+            StreamFile fileStream;
+            fileStream.setBigendian( true );
+
+            if ( !fileStream.open( _filePath, "wb" ) ) {
+                return;
+            }
+
+            fileStream << mapCatalogueMagicValue << mapCatalogueVersion << static_cast<uint32_t>( _entries.size() );
+
+            for ( const auto & [key, entry] : _entries ) {
+                fileStream << key.first << key.second;
+                writeUint64( fileStream, entry.fileSize );
+                writeUint64( fileStream, static_cast<uint64_t>( entry.modificationTime ) );
+                fileStream << entry.language << entry.isValid;
+
+                if ( entry.isValid ) {
+                    const Maps::FileInfo & fi = entry.info;
+
+                    fileStream << fi.name << fi.description << fi.width << fi.height << fi.difficulty << fi.races << fi.unions << fi.kingdomColors
+                               << fi.colorsAvailableForHumans << fi.colorsAvailableForComp << fi.colorsOfRandomRaces << fi.victoryConditionType << fi.compAlsoWins
+                               << fi.allowNormalVictory << fi.victoryConditionParams << fi.lossConditionType << fi.lossConditionParams << fi.timestamp
+                               << fi.startWithHeroInFirstCastle << fi.version << fi.worldDay << fi.worldWeek << fi.worldMonth << fi.mainLanguage << fi.translations
+                               << fi.creatorNotes;
+                }
+            }
+
+            if ( fileStream.fail() ) {
+                ERROR_LOG( "Failed to write the map catalogue file " << _filePath )
+                return;
+            }
+
+            _isModified = false;
+        }
+
+    private:
+        const std::string _filePath;
+
+        std::map<MapCatalogueKey, MapCatalogueEntry> _entries;
+
+        bool _isModified{ false };
+
+        void _load()
+        {
+            StreamFile fileStream;
+            fileStream.setBigendian( true );
+
+            if ( !fileStream.open( _filePath, "rb" ) ) {
+                return;
+            }
+
+            uint32_t magicValue = 0;
+            uint16_t version = 0;
+            uint32_t entryCount = 0;
+
+            fileStream >> magicValue >> version >> entryCount;
+            if ( magicValue != mapCatalogueMagicValue || version != mapCatalogueVersion ) {
+                return;
+            }
+
+            for ( uint32_t i = 0; i < entryCount; ++i ) {
+                MapCatalogueKey key;
+                MapCatalogueEntry entry;
+
+                fileStream >> key.first >> key.second;
+                entry.fileSize = readUint64( fileStream );
+                entry.modificationTime = static_cast<int64_t>( readUint64( fileStream ) );
+                fileStream >> entry.language >> entry.isValid;
+
+                if ( entry.isValid ) {
+                    Maps::FileInfo & fi = entry.info;
+
+                    fileStream >> fi.name >> fi.description >> fi.width >> fi.height >> fi.difficulty >> fi.races >> fi.unions >> fi.kingdomColors
+                        >> fi.colorsAvailableForHumans >> fi.colorsAvailableForComp >> fi.colorsOfRandomRaces >> fi.victoryConditionType >> fi.compAlsoWins
+                        >> fi.allowNormalVictory >> fi.victoryConditionParams >> fi.lossConditionType >> fi.lossConditionParams >> fi.timestamp
+                        >> fi.startWithHeroInFirstCastle >> fi.version >> fi.worldDay >> fi.worldWeek >> fi.worldMonth >> fi.mainLanguage >> fi.translations
+                        >> fi.creatorNotes;
+
+                    fi.filename = key.first;
+                }
+
+                if ( fileStream.fail() ) {
+                    // The catalogue file is corrupted. All map files are going to be read again.
+                    _entries.clear();
+                    return;
+                }
+
+                _entries.try_emplace( std::move( key ), std::move( entry ) );
+            }
+        }
+    };
+
+    MapCatalogue & getMapCatalogue()
+    {
+        static MapCatalogue catalogue;
+
+        return catalogue;
+    }
+
+    // Reads headers of the given map files. Only files which have been changed since the previous reading are actually read,
+    // and they are read in parallel. This function returns only valid maps in the order of the given files.
+    MapsFileInfoList readMapFileInfos( const ListFiles & files, const bool isOriginalMapFormat, const bool isForEditor )
+    {
+        const std::vector<std::string> mapFiles( files.begin(), files.end() );
+
+        const fheroes2::SupportedLanguage currentLanguage = fheroes2::getCurrentLanguage();
+
+        // The language does not affect original maps and Resurrection maps loaded for the Editor.
+        const fheroes2::SupportedLanguage language = ( isOriginalMapFormat || isForEditor ) ? fheroes2::SupportedLanguage::English : currentLanguage;
+
+        MapCatalogue & catalogue = getMapCatalogue();
+
+        std::vector<const MapCatalogueEntry *> entries( mapFiles.size(), nullptr );
+
+        // Files which have to be read.
+        std::vector<size_t> fileIds;
+        std::vector<MapCatalogueEntry> newEntries;
+
+        for ( size_t i = 0; i < mapFiles.size(); ++i ) {
+            MapCatalogueEntry entry;
+            if ( !System::getFileSizeAndModificationTime( mapFiles[i], entry.fileSize, entry.modificationTime ) ) {
+                continue;
+            }
+
+            entries[i] = catalogue.find( MapCatalogueKey{ mapFiles[i], isForEditor }, entry.fileSize, entry.modificationTime, language );
+            if ( entries[i] != nullptr ) {
+                continue;
+            }
+
+            entry.language = language;
+
+            fileIds.push_back( i );
+            newEntries.emplace_back( std::move( entry ) );
+        }
+
+        if ( !fileIds.empty() ) {
+            MultiThreading::WorkerPool workerPool( std::min<size_t>( std::thread::hardware_concurrency(), std::min( fileIds.size(), maxMapReaderThreadCount ) ) );
+
+            workerPool.execute(
+                fileIds.size(),
+                [&mapFiles, &fileIds, &newEntries, isOriginalMapFormat, isForEditor, currentLanguage]( const size_t taskId, const size_t /* workerId */ ) {
+                    MapCatalogueEntry & entry = newEntries[taskId];
+
+                    if ( isOriginalMapFormat ) {
+                        entry.isValid = entry.info.readMP2Map( mapFiles[fileIds[taskId]], isForEditor );
+                    }
+                    else {
+                        entry.isValid = entry.info.readResurrectionMap( mapFiles[fileIds[taskId]], isForEditor, currentLanguage );
+                    }
+                },
+                {} );
+
+            for ( size_t i = 0; i < fileIds.size(); ++i ) {
+                if ( !newEntries[i].isValid ) {
+                    newEntries[i].info = {};
+                }
+
+                const MapCatalogueKey key{ mapFiles[fileIds[i]], isForEditor };
+                const uint64_t fileSize = newEntries[i].fileSize;
+                const int64_t modificationTime = newEntries[i].modificationTime;
+
+                catalogue.update( key, std::move( newEntries[i] ) );
+
+                entries[fileIds[i]] = catalogue.find( key, fileSize, modificationTime, language );
+            }
+
+            catalogue.save();
+        }
 
         MapsFileInfoList result;
         result.reserve( mapFiles.size() );
 
-        const auto currentLanguage = fheroes2::getCurrentLanguage();
+        for ( const MapCatalogueEntry * entry : entries ) {
+            if ( entry != nullptr && entry->isValid ) {
+                result.emplace_back( entry->info );
+            }
+        }
+
+        return result;
+    }
+
+    // This function returns an unsorted array. It is a caller responsibility to take care of sorting if needed.
+    MapsFileInfoList getValidMaps( const ListFiles & mapFiles, const uint8_t humanPlayerCount, const bool isOriginalMapFormat )
+    {
+        assert( humanPlayerCount >= 1 );
+
+        MapsFileInfoList result = readMapFileInfos( mapFiles, isOriginalMapFormat, false );
 
         // Maps made by the original French version Editor or hacked maps could contain
         // special ASCII characters that are not supposed to be there.
@@ -78,44 +354,31 @@ namespace
             = isOriginalMapFormat
               && ( fheroes2::getCurrentLanguage() == fheroes2::SupportedLanguage::French && fheroes2::getResourceLanguage() == fheroes2::SupportedLanguage::French );
 
-        for ( const std::string & mapFile : mapFiles ) {
-            Maps::FileInfo fi;
-
-            if ( isOriginalMapFormat ) {
-                if ( !fi.readMP2Map( mapFile, false ) ) {
-                    continue;
-                }
-            }
-            else {
-                if ( !fi.readResurrectionMap( mapFile, false, currentLanguage ) ) {
-                    continue;
-                }
-            }
-
+        const auto isUnsuitableMap = [humanPlayerCount]( const Maps::FileInfo & fi ) {
             const int humanOnlyColorsCount = Color::Count( fi.HumanOnlyColors() );
             if ( humanOnlyColorsCount > humanPlayerCount ) {
                 // This map requires more human-only players than needed.
-                continue;
+                return true;
             }
 
             const int computerHumanColorsCount = Color::Count( fi.AllowCompHumanColors() );
-            if ( humanPlayerCount > ( humanOnlyColorsCount + computerHumanColorsCount ) ) {
-                // This map does not allow to be played by this number of human players.
-                continue;
-            }
+            // This map does not allow to be played by this number of human players.
+            return humanPlayerCount > ( humanOnlyColorsCount + computerHumanColorsCount );
+        };
 
-            if ( humanOnlyColorsCount == humanPlayerCount ) {
+        result.erase( std::remove_if( result.begin(), result.end(), isUnsuitableMap ), result.end() );
+
+        for ( Maps::FileInfo & fi : result ) {
+            if ( Color::Count( fi.HumanOnlyColors() ) == humanPlayerCount ) {
                 // The map has the exact number of human-only players. Make sure that the user cannot select any other players.
                 fi.removeHumanColors( fi.AllowCompHumanColors() );
             }
 
             // Update French language-specific characters to match CP1252.
-            if ( isOriginalMapFormat && fixSpecialFrenchCharacters ) {
+            if ( fixSpecialFrenchCharacters ) {
                 fheroes2::fixFrenchCharactersForMP2Map( fi.name );
                 fheroes2::fixFrenchCharactersForMP2Map( fi.description );
             }
-
-            result.emplace_back( std::move( fi ) );
         }
 
         return result;
@@ -770,16 +1033,10 @@ MapsFileInfoList Maps::getEditorMapFileInfos()
 
     // There could be different file locations but with the same filename.
     std::multimap<std::string, Maps::FileInfo, std::less<>> sortedMaps;
-    const auto currentLanguage = fheroes2::getCurrentLanguage();
-
-    for ( const std::string & mapFile : maps ) {
-        Maps::FileInfo fi;
-
-        if ( !fi.readResurrectionMap( mapFile, true, currentLanguage ) ) {
-            continue;
-        }
 
-        sortedMaps.emplace( StringLower( System::GetFileName( mapFile ) ), std::move( fi ) );
+    for ( Maps::FileInfo & fi : readMapFileInfos( maps, false, true ) ) {
+        std::string name = StringLower( System::GetFileName( fi.filename ) );
+        sortedMaps.emplace( std::move( name ), std::move( fi ) );
     }
 
     if ( sortedMaps.empty() ) {
@@ -476,16 +476,23 @@ MP2::MapObjectType Maps::Tile::_getMainObjectTypeUnderHero() const
 
 void Maps::Tile::setMainObjectType( const MP2::MapObjectType objectType )
 {
+    const MP2::MapObjectType previousObjectType = _mainObjectType;
     _mainObjectType = objectType;
 
-    world.resetPathfinder();
+    // Temporary copies of tiles (for example, while reading map headers in parallel) must not touch the world.
+    if ( !world.isWorldTile( *this ) ) {
+        return;
+    }
+
+    world.updateObjectIndex( *this, previousObjectType );
+    world.invalidatePathfinderTile( _index );
 }
 
 void Maps::Tile::setBoat( const int direction, const PlayerColor color )
 {
     if ( _mainObjectPart.icnType != MP2::OBJ_ICN_TYPE_UNKNOWN ) {
         // It is important to preserve the order of objects for rendering purposes. Therefore, the main object should go to the front of objects.
-        _groundObjectPart.emplace_front( _mainObjectPart );
+        _groundObjectPart.insert( _groundObjectPart.begin(), _mainObjectPart );
     }
 
     // If this assertion blows up then you are trying to put a boat on land!
@@ -839,11 +846,11 @@ void Maps::Tile::sortObjectParts()
 
     // Push everything to the container and sort it by level.
     if ( _mainObjectPart.icnType != MP2::OBJ_ICN_TYPE_UNKNOWN ) {
-        _groundObjectPart.emplace_front( _mainObjectPart );
+        _groundObjectPart.insert( _groundObjectPart.begin(), _mainObjectPart );
     }
 
     // Sort by internal layers.
-    _groundObjectPart.sort( []( const auto & left, const auto & right ) { return ( left.layerType > right.layerType ); } );
+    std::stable_sort( _groundObjectPart.begin(), _groundObjectPart.end(), []( const auto & left, const auto & right ) { return ( left.layerType > right.layerType ); } );
 
     if ( !_groundObjectPart.empty() ) {
         auto highestPriorityPartIter = _groundObjectPart.end();
@@ -1184,6 +1191,12 @@ Maps::ObjectPart * Maps::Tile::getObjectPartWithFlag( const uint32_t uid )
 
 void Maps::Tile::setOwnershipFlag( const MP2::MapObjectType objectType, PlayerColor color )
 {
+    // Captured objects (including castles) can occupy several tiles around this one and all of them are rendered in the color of the owner on the radar map.
+    if ( world.isWorldTile( *this ) ) {
+        const fheroes2::Point position = GetPoint( _index );
+        world.markRadarAreaChanged( { position.x - 2, position.y - 3, 5, 5 } );
+    }
+
     // All flags in FLAG32.ICN are actually the same except the fact of having different offset.
     // Set the default value for the UNUSED color.
     uint8_t objectSpriteIndex = 6;
@@ -1284,8 +1297,8 @@ void Maps::Tile::updateFlag( const PlayerColor color, const uint8_t objectSprite
     // Flag deletion or installation must be done in relation to object UID as flag is attached to the object.
     if ( color == PlayerColor::NONE ) {
         const auto isFlag = [uid]( const auto & part ) { return part._uid == uid && part.icnType == MP2::OBJ_ICN_TYPE_FLAG32; };
-        _groundObjectPart.remove_if( isFlag );
-        _topObjectPart.remove_if( isFlag );
+        _groundObjectPart.erase( std::remove_if( _groundObjectPart.begin(), _groundObjectPart.end(), isFlag ), _groundObjectPart.end() );
+        _topObjectPart.erase( std::remove_if( _topObjectPart.begin(), _topObjectPart.end(), isFlag ), _topObjectPart.end() );
         return;
     }
 
@@ -1451,14 +1464,16 @@ bool Maps::Tile::removeObjectPartsByUID( const uint32_t objectUID )
 {
     bool isObjectPartRemoved = false;
 
+    const auto isObjectPart = [objectUID]( const auto & v ) { return v._uid == objectUID; };
+
     size_t partCountBefore = _groundObjectPart.size();
-    _groundObjectPart.remove_if( [objectUID]( const auto & v ) { return v._uid == objectUID; } );
+    _groundObjectPart.erase( std::remove_if( _groundObjectPart.begin(), _groundObjectPart.end(), isObjectPart ), _groundObjectPart.end() );
     if ( partCountBefore != _groundObjectPart.size() ) {
         isObjectPartRemoved = true;
     }
 
     partCountBefore = _topObjectPart.size();
-    _topObjectPart.remove_if( [objectUID]( const auto & v ) { return v._uid == objectUID; } );
+    _topObjectPart.erase( std::remove_if( _topObjectPart.begin(), _topObjectPart.end(), isObjectPart ), _topObjectPart.end() );
     if ( partCountBefore != _topObjectPart.size() ) {
         isObjectPartRemoved = true;
     }
@@ -1510,8 +1525,9 @@ bool Maps::Tile::removeObjectPartsByUID( const uint32_t objectUID )
 
 void Maps::Tile::removeObjects( const MP2::ObjectIcnType objectIcnType )
 {
-    _groundObjectPart.remove_if( [objectIcnType]( const auto & part ) { return part.icnType == objectIcnType; } );
-    _topObjectPart.remove_if( [objectIcnType]( const auto & part ) { return part.icnType == objectIcnType; } );
+    const auto isObjectIcnType = [objectIcnType]( const auto & part ) { return part.icnType == objectIcnType; };
+    _groundObjectPart.erase( std::remove_if( _groundObjectPart.begin(), _groundObjectPart.end(), isObjectIcnType ), _groundObjectPart.end() );
+    _topObjectPart.erase( std::remove_if( _topObjectPart.begin(), _topObjectPart.end(), isObjectIcnType ), _topObjectPart.end() );
 
     if ( _mainObjectPart.icnType == objectIcnType ) {
         _mainObjectPart = {};
@@ -1577,10 +1593,12 @@ void Maps::Tile::ClearFog( const PlayerColorsSet colors )
 {
     _fogColors &= ~colors;
 
+    world.clearTileFog( _index, colors );
+
     // The fog might be cleared even without the hero's movement - for example, the hero can gain a new level of Scouting
     // skill by picking up a Treasure Chest from a nearby tile or buying a map in a Magellan's Maps object using the space
-    // bar button. Reset the pathfinder(s) to make the newly discovered tiles immediately available for this hero.
-    world.resetPathfinder();
+    // bar button. Update the pathfinder(s) to make the newly discovered tiles immediately available for this hero.
+    world.invalidatePathfinderTile( _index );
 }
 
 void Maps::Tile::updateTileObjectIcnIndex( Maps::Tile & tile, const uint32_t uid, const uint8_t newIndex )
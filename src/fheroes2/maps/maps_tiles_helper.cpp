@@ -54,6 +54,7 @@
 #include "tools.h"
 #include "week.h"
 #include "world.h"
+#include "world_fog.h"
 #include "world_object_uid.h"
 
 namespace
@@ -2135,12 +2136,14 @@ namespace Maps
 
         // Cache the 'fogData' data for the given area to use it in fog direction calculation.
         // The loops run only within the world area, if 'fogData' area includes tiles outside the world borders we do not update them as the are already set to 1.
+        const WorldFog & fog = world.getFog();
+
         for ( int32_t y = fogMinY; y < fogMaxY; ++y ) {
             const int32_t fogTileOffsetY = y * worldWidth;
             const int32_t fogDataOffsetY = y * fogDataWidth + fogDataOffset;
 
             for ( int32_t x = fogMinX; x < fogMaxX; ++x ) {
-                fogData[x + fogDataOffsetY] = world.getTile( x + fogTileOffsetY ).isFog( colors ) ? 1 : 0;
+                fogData[x + fogDataOffsetY] = fog.isFog( x + fogTileOffsetY, colors ) ? 1 : 0;
             }
         }
 
@@ -97,6 +97,31 @@ namespace
         return false;
     }
 
+    bool isObjectPartAnimated( const MP2::ObjectIcnType icnType, const uint8_t icnIndex )
+    {
+        const auto * objectInfo = Maps::getObjectPartByIcn( icnType, icnIndex );
+        return objectInfo != nullptr && objectInfo->animationFrames > 0;
+    }
+
+    bool isTerrainLayerAnimated( const Maps::Tile & tile )
+    {
+        for ( const auto & part : tile.getGroundObjectParts() ) {
+            if ( part.layerType == Maps::TERRAIN_LAYER && isObjectPartAnimated( part.icnType, part.icnIndex ) ) {
+                return true;
+            }
+        }
+
+        const auto & mainPart = tile.getMainObjectPart();
+        return mainPart.icnType != MP2::OBJ_ICN_TYPE_UNKNOWN && mainPart.layerType == Maps::TERRAIN_LAYER && isObjectPartAnimated( mainPart.icnType, mainPart.icnIndex );
+    }
+
+    // Renders a static object part at the given position of the image instead of the position in the game area.
+    void renderStaticObjectPart( fheroes2::Image & output, const fheroes2::Point & pos, const int icnId, const uint8_t icnIndex )
+    {
+        const fheroes2::Sprite & sprite = fheroes2::AGG::GetICN( icnId, icnIndex );
+        fheroes2::Blit( sprite, output, pos.x + sprite.x(), pos.y + sprite.y() );
+    }
+
     void renderObjectPart( fheroes2::Image & output, const Interface::GameArea & area, const fheroes2::Point & offset, const Maps::ObjectPart & part )
     {
         assert( part.icnType != MP2::OBJ_ICN_TYPE_UNKNOWN && part.icnIndex != 255 );
@@ -628,6 +653,17 @@ namespace
         icnId = ICN::FROTH;
         icnIndex = icnIndex + ( heroMovementIndex % Heroes::heroFrameCountPerTile );
     }
+
+    // Divides the sprite by tiles and adds rendering information of every part to the array.
+    void addSpriteSquares( fheroes2::ArenaVector<fheroes2::ObjectRenderingInfo> & objectInfo, const fheroes2::Point & spriteOffset, const fheroes2::Sprite & sprite,
+                           const int icnId, const uint32_t icnIndex, const bool isFlipped )
+    {
+        fheroes2::DivideImageBySquares( spriteOffset, sprite, fheroes2::tileWidthPx,
+                                        [&objectInfo, icnId, icnIndex, isFlipped]( const fheroes2::Point & squareId, const fheroes2::Point & imageOffset,
+                                                                                   const fheroes2::Rect & imageRoi ) {
+                                            objectInfo.emplace_back( squareId, imageOffset, imageRoi, icnId, icnIndex, isFlipped, static_cast<uint8_t>( 255 ) );
+                                        } );
+    }
 }
 
 namespace Maps
@@ -1005,7 +1041,7 @@ namespace Maps
         }
     }
 
-    std::vector<fheroes2::ObjectRenderingInfo> getMonsterSpritesPerTile( const Tile & tile, const bool isEditorMode )
+    fheroes2::ArenaVector<fheroes2::ObjectRenderingInfo> getMonsterSpritesPerTile( const Tile & tile, const bool isEditorMode, fheroes2::MemoryArena & arena )
     {
         assert( tile.getMainObjectType() == MP2::OBJ_MONSTER );
 
@@ -1016,39 +1052,20 @@ namespace Maps
         const fheroes2::Sprite & monsterSprite = fheroes2::AGG::GetICN( icnId, spriteIndices.first );
         const fheroes2::Point monsterSpriteOffset( monsterSprite.x() + monsterImageOffset.x, monsterSprite.y() + monsterImageOffset.y );
 
-        std::vector<fheroes2::Point> outputSquareInfo;
-        std::vector<std::pair<fheroes2::Point, fheroes2::Rect>> outputImageInfo;
-        fheroes2::DivideImageBySquares( monsterSpriteOffset, monsterSprite, fheroes2::tileWidthPx, outputSquareInfo, outputImageInfo );
-
-        assert( outputSquareInfo.size() == outputImageInfo.size() );
-
-        std::vector<fheroes2::ObjectRenderingInfo> objectInfo;
-        for ( size_t i = 0; i < outputSquareInfo.size(); ++i ) {
-            objectInfo.emplace_back( outputSquareInfo[i], outputImageInfo[i].first, outputImageInfo[i].second, icnId, spriteIndices.first, false,
-                                     static_cast<uint8_t>( 255 ) );
-        }
-
-        outputSquareInfo.clear();
-        outputImageInfo.clear();
+        fheroes2::ArenaVector<fheroes2::ObjectRenderingInfo> objectInfo( fheroes2::ArenaAllocator<fheroes2::ObjectRenderingInfo>{ arena } );
+        addSpriteSquares( objectInfo, monsterSpriteOffset, monsterSprite, icnId, spriteIndices.first, false );
 
         if ( spriteIndices.second > 0 ) {
             const fheroes2::Sprite & secondaryMonsterSprite = fheroes2::AGG::GetICN( icnId, spriteIndices.second );
             const fheroes2::Point secondaryMonsterSpriteOffset( secondaryMonsterSprite.x() + monsterImageOffset.x, secondaryMonsterSprite.y() + monsterImageOffset.y );
 
-            fheroes2::DivideImageBySquares( secondaryMonsterSpriteOffset, secondaryMonsterSprite, fheroes2::tileWidthPx, outputSquareInfo, outputImageInfo );
-
-            assert( outputSquareInfo.size() == outputImageInfo.size() );
-
-            for ( size_t i = 0; i < outputSquareInfo.size(); ++i ) {
-                objectInfo.emplace_back( outputSquareInfo[i], outputImageInfo[i].first, outputImageInfo[i].second, icnId, spriteIndices.second, false,
-                                         static_cast<uint8_t>( 255 ) );
-            }
+            addSpriteSquares( objectInfo, secondaryMonsterSpriteOffset, secondaryMonsterSprite, icnId, spriteIndices.second, false );
         }
 
         return objectInfo;
     }
 
-    std::vector<fheroes2::ObjectRenderingInfo> getMonsterShadowSpritesPerTile( const Tile & tile, const bool isEditorMode )
+    fheroes2::ArenaVector<fheroes2::ObjectRenderingInfo> getMonsterShadowSpritesPerTile( const Tile & tile, const bool isEditorMode, fheroes2::MemoryArena & arena )
     {
         assert( tile.getMainObjectType() == MP2::OBJ_MONSTER );
 
@@ -1059,39 +1076,20 @@ namespace Maps
         const fheroes2::Sprite & monsterSprite = fheroes2::AGG::GetICN( icnId, spriteIndices.first );
         const fheroes2::Point monsterSpriteOffset( monsterSprite.x() + monsterImageOffset.x, monsterSprite.y() + monsterImageOffset.y );
 
-        std::vector<fheroes2::Point> outputSquareInfo;
-        std::vector<std::pair<fheroes2::Point, fheroes2::Rect>> outputImageInfo;
-        fheroes2::DivideImageBySquares( monsterSpriteOffset, monsterSprite, fheroes2::tileWidthPx, outputSquareInfo, outputImageInfo );
-
-        assert( outputSquareInfo.size() == outputImageInfo.size() );
-
-        std::vector<fheroes2::ObjectRenderingInfo> objectInfo;
-        for ( size_t i = 0; i < outputSquareInfo.size(); ++i ) {
-            objectInfo.emplace_back( outputSquareInfo[i], outputImageInfo[i].first, outputImageInfo[i].second, icnId, spriteIndices.first, false,
-                                     static_cast<uint8_t>( 255 ) );
-        }
-
-        outputSquareInfo.clear();
-        outputImageInfo.clear();
+        fheroes2::ArenaVector<fheroes2::ObjectRenderingInfo> objectInfo( fheroes2::ArenaAllocator<fheroes2::ObjectRenderingInfo>{ arena } );
+        addSpriteSquares( objectInfo, monsterSpriteOffset, monsterSprite, icnId, spriteIndices.first, false );
 
         if ( spriteIndices.second > 0 ) {
             const fheroes2::Sprite & secondaryMonsterSprite = fheroes2::AGG::GetICN( icnId, spriteIndices.second );
             const fheroes2::Point secondaryMonsterSpriteOffset( secondaryMonsterSprite.x() + monsterImageOffset.x, secondaryMonsterSprite.y() + monsterImageOffset.y );
 
-            fheroes2::DivideImageBySquares( secondaryMonsterSpriteOffset, secondaryMonsterSprite, fheroes2::tileWidthPx, outputSquareInfo, outputImageInfo );
-
-            assert( outputSquareInfo.size() == outputImageInfo.size() );
-
-            for ( size_t i = 0; i < outputSquareInfo.size(); ++i ) {
-                objectInfo.emplace_back( outputSquareInfo[i], outputImageInfo[i].first, outputImageInfo[i].second, icnId, spriteIndices.second, false,
-                                         static_cast<uint8_t>( 255 ) );
-            }
+            addSpriteSquares( objectInfo, secondaryMonsterSpriteOffset, secondaryMonsterSprite, icnId, spriteIndices.second, false );
         }
 
         return objectInfo;
     }
 
-    std::vector<fheroes2::ObjectRenderingInfo> getBoatSpritesPerTile( const Tile & tile )
+    fheroes2::ArenaVector<fheroes2::ObjectRenderingInfo> getBoatSpritesPerTile( const Tile & tile, fheroes2::MemoryArena & arena )
     {
         // TODO: combine both boat image generation for heroes and empty boats.
         assert( tile.getMainObjectType() == MP2::OBJ_BOAT );
@@ -1107,22 +1105,13 @@ namespace Maps
         const fheroes2::Point boatSpriteOffset( ( isReflected ? ( fheroes2::tileWidthPx + 1 - boatSprite.x() - boatSprite.width() ) : boatSprite.x() ),
                                                 boatSprite.y() + fheroes2::tileWidthPx - 11 );
 
-        std::vector<fheroes2::Point> outputSquareInfo;
-        std::vector<std::pair<fheroes2::Point, fheroes2::Rect>> outputImageInfo;
-        fheroes2::DivideImageBySquares( boatSpriteOffset, boatSprite, fheroes2::tileWidthPx, outputSquareInfo, outputImageInfo );
-
-        assert( outputSquareInfo.size() == outputImageInfo.size() );
-
-        std::vector<fheroes2::ObjectRenderingInfo> objectInfo;
-        for ( size_t i = 0; i < outputSquareInfo.size(); ++i ) {
-            objectInfo.emplace_back( outputSquareInfo[i], outputImageInfo[i].first, outputImageInfo[i].second, icnId, icnIndex, isReflected,
-                                     static_cast<uint8_t>( 255 ) );
-        }
+        fheroes2::ArenaVector<fheroes2::ObjectRenderingInfo> objectInfo( fheroes2::ArenaAllocator<fheroes2::ObjectRenderingInfo>{ arena } );
+        addSpriteSquares( objectInfo, boatSpriteOffset, boatSprite, icnId, icnIndex, isReflected );
 
         return objectInfo;
     }
 
-    std::vector<fheroes2::ObjectRenderingInfo> getBoatShadowSpritesPerTile( const Tile & tile )
+    fheroes2::ArenaVector<fheroes2::ObjectRenderingInfo> getBoatShadowSpritesPerTile( const Tile & tile, fheroes2::MemoryArena & arena )
     {
         assert( tile.getMainObjectType() == MP2::OBJ_BOAT );
 
@@ -1135,25 +1124,17 @@ namespace Maps
         const fheroes2::Point boatShadowSpriteOffset( boatShadowSprite.x(), fheroes2::tileWidthPx + boatShadowSprite.y() - 11 );
 
         // Shadows cannot be flipped so flip flag is always false.
-        std::vector<fheroes2::Point> outputSquareInfo;
-        std::vector<std::pair<fheroes2::Point, fheroes2::Rect>> outputImageInfo;
-        fheroes2::DivideImageBySquares( boatShadowSpriteOffset, boatShadowSprite, fheroes2::tileWidthPx, outputSquareInfo, outputImageInfo );
-
-        assert( outputSquareInfo.size() == outputImageInfo.size() );
-
-        std::vector<fheroes2::ObjectRenderingInfo> objectInfo;
-        for ( size_t i = 0; i < outputSquareInfo.size(); ++i ) {
-            objectInfo.emplace_back( outputSquareInfo[i], outputImageInfo[i].first, outputImageInfo[i].second, icnId, icnIndex, false, static_cast<uint8_t>( 255 ) );
-        }
+        fheroes2::ArenaVector<fheroes2::ObjectRenderingInfo> objectInfo( fheroes2::ArenaAllocator<fheroes2::ObjectRenderingInfo>{ arena } );
+        addSpriteSquares( objectInfo, boatShadowSpriteOffset, boatShadowSprite, icnId, icnIndex, false );
 
         return objectInfo;
     }
 
-    std::vector<fheroes2::ObjectRenderingInfo> getMineGuardianSpritesPerTile( const Tile & tile )
+    fheroes2::ArenaVector<fheroes2::ObjectRenderingInfo> getMineGuardianSpritesPerTile( const Tile & tile, fheroes2::MemoryArena & arena )
     {
         assert( tile.getMainObjectType( false ) == MP2::OBJ_MINE );
 
-        std::vector<fheroes2::ObjectRenderingInfo> objectInfo;
+        fheroes2::ArenaVector<fheroes2::ObjectRenderingInfo> objectInfo( fheroes2::ArenaAllocator<fheroes2::ObjectRenderingInfo>{ arena } );
 
         const int32_t spellID = Maps::getMineSpellIdFromTile( tile );
         switch ( spellID ) {
@@ -1169,15 +1150,7 @@ namespace Maps
             const uint32_t icnIndex = spellID - Spell::SETEGUARDIAN;
             const fheroes2::Sprite & image = fheroes2::AGG::GetICN( icnId, icnIndex );
 
-            std::vector<fheroes2::Point> outputSquareInfo;
-            std::vector<std::pair<fheroes2::Point, fheroes2::Rect>> outputImageInfo;
-            fheroes2::DivideImageBySquares( { image.x(), image.y() }, image, fheroes2::tileWidthPx, outputSquareInfo, outputImageInfo );
-
-            assert( outputSquareInfo.size() == outputImageInfo.size() );
-
-            for ( size_t i = 0; i < outputSquareInfo.size(); ++i ) {
-                objectInfo.emplace_back( outputSquareInfo[i], outputImageInfo[i].first, outputImageInfo[i].second, icnId, icnIndex, false, static_cast<uint8_t>( 255 ) );
-            }
+            addSpriteSquares( objectInfo, { image.x(), image.y() }, image, icnId, icnIndex, false );
             break;
         }
         default:
@@ -1187,7 +1160,7 @@ namespace Maps
         return objectInfo;
     }
 
-    std::vector<fheroes2::ObjectRenderingInfo> getHeroSpritesPerTile( const Heroes & hero )
+    fheroes2::ArenaVector<fheroes2::ObjectRenderingInfo> getHeroSpritesPerTile( const Heroes & hero, fheroes2::MemoryArena & arena )
     {
         // Reflected hero sprite should be shifted by 1 pixel to right.
         const bool reflect = doesHeroImageNeedToBeReflected( hero.GetDirection() );
@@ -1217,19 +1190,8 @@ namespace Maps
         const fheroes2::Point heroSpriteOffset( offset.x + ( reflect ? ( fheroes2::tileWidthPx + 1 - spriteHero.x() - spriteHero.width() ) : spriteHero.x() ),
                                                 offset.y + spriteHero.y() + fheroes2::tileWidthPx );
 
-        std::vector<fheroes2::Point> outputSquareInfo;
-        std::vector<std::pair<fheroes2::Point, fheroes2::Rect>> outputImageInfo;
-        fheroes2::DivideImageBySquares( heroSpriteOffset, spriteHero, fheroes2::tileWidthPx, outputSquareInfo, outputImageInfo );
-
-        assert( outputSquareInfo.size() == outputImageInfo.size() );
-
-        std::vector<fheroes2::ObjectRenderingInfo> objectInfo;
-        for ( size_t i = 0; i < outputSquareInfo.size(); ++i ) {
-            objectInfo.emplace_back( outputSquareInfo[i], outputImageInfo[i].first, outputImageInfo[i].second, icnId, icnIndex, reflect, static_cast<uint8_t>( 255 ) );
-        }
-
-        outputSquareInfo.clear();
-        outputImageInfo.clear();
+        fheroes2::ArenaVector<fheroes2::ObjectRenderingInfo> objectInfo( fheroes2::ArenaAllocator<fheroes2::ObjectRenderingInfo>{ arena } );
+        addSpriteSquares( objectInfo, heroSpriteOffset, spriteHero, icnId, icnIndex, reflect );
 
         fheroes2::Point flagOffset;
         getFlagSpriteInfo( hero, flagFrameID, false, flagOffset, icnId, icnIndex );
@@ -1240,16 +1202,7 @@ namespace Maps
                                                                 : spriteFlag.x() + flagOffset.x ),
                                                 offset.y + spriteFlag.y() + flagOffset.y + fheroes2::tileWidthPx );
 
-        fheroes2::DivideImageBySquares( flagSpriteOffset, spriteFlag, fheroes2::tileWidthPx, outputSquareInfo, outputImageInfo );
-
-        assert( outputSquareInfo.size() == outputImageInfo.size() );
-
-        for ( size_t i = 0; i < outputSquareInfo.size(); ++i ) {
-            objectInfo.emplace_back( outputSquareInfo[i], outputImageInfo[i].first, outputImageInfo[i].second, icnId, icnIndex, reflect, static_cast<uint8_t>( 255 ) );
-        }
-
-        outputSquareInfo.clear();
-        outputImageInfo.clear();
+        addSpriteSquares( objectInfo, flagSpriteOffset, spriteFlag, icnId, icnIndex, reflect );
 
         if ( hero.isShipMaster() && hero.isMoveEnabled() && hero.isInDeepOcean() ) {
             // TODO: draw froth for all boats in deep water, not only for a moving boat.
@@ -1258,18 +1211,13 @@ namespace Maps
             const fheroes2::Point frothSpriteOffset( offset.x + ( reflect ? fheroes2::tileWidthPx - spriteFroth.x() - spriteFroth.width() : spriteFroth.x() ),
                                                      offset.y + spriteFroth.y() + fheroes2::tileWidthPx );
 
-            fheroes2::DivideImageBySquares( frothSpriteOffset, spriteFroth, fheroes2::tileWidthPx, outputSquareInfo, outputImageInfo );
-
-            for ( size_t i = 0; i < outputSquareInfo.size(); ++i ) {
-                objectInfo.emplace_back( outputSquareInfo[i], outputImageInfo[i].first, outputImageInfo[i].second, icnId, icnIndex, reflect,
-                                         static_cast<uint8_t>( 255 ) );
-            }
+            addSpriteSquares( objectInfo, frothSpriteOffset, spriteFroth, icnId, icnIndex, reflect );
         }
 
         return objectInfo;
     }
 
-    std::vector<fheroes2::ObjectRenderingInfo> getHeroShadowSpritesPerTile( const Heroes & hero )
+    fheroes2::ArenaVector<fheroes2::ObjectRenderingInfo> getHeroShadowSpritesPerTile( const Heroes & hero, fheroes2::MemoryArena & arena )
     {
         fheroes2::Point offset;
         // Boat sprite has to be shifted so it matches other boats.
@@ -1287,21 +1235,13 @@ namespace Maps
         const fheroes2::Sprite & spriteShadow = fheroes2::AGG::GetICN( icnId, icnIndex );
         const fheroes2::Point shadowSpriteOffset( offset.x + spriteShadow.x(), offset.y + spriteShadow.y() + fheroes2::tileWidthPx );
 
-        std::vector<fheroes2::Point> outputSquareInfo;
-        std::vector<std::pair<fheroes2::Point, fheroes2::Rect>> outputImageInfo;
-        fheroes2::DivideImageBySquares( shadowSpriteOffset, spriteShadow, fheroes2::tileWidthPx, outputSquareInfo, outputImageInfo );
-
-        assert( outputSquareInfo.size() == outputImageInfo.size() );
-
-        std::vector<fheroes2::ObjectRenderingInfo> objectInfo;
-        for ( size_t i = 0; i < outputSquareInfo.size(); ++i ) {
-            objectInfo.emplace_back( outputSquareInfo[i], outputImageInfo[i].first, outputImageInfo[i].second, icnId, icnIndex, false, static_cast<uint8_t>( 255 ) );
-        }
+        fheroes2::ArenaVector<fheroes2::ObjectRenderingInfo> objectInfo( fheroes2::ArenaAllocator<fheroes2::ObjectRenderingInfo>{ arena } );
+        addSpriteSquares( objectInfo, shadowSpriteOffset, spriteShadow, icnId, icnIndex, false );
 
         return objectInfo;
     }
 
-    std::vector<fheroes2::ObjectRenderingInfo> getEditorHeroSpritesPerTile( const Tile & tile )
+    fheroes2::ArenaVector<fheroes2::ObjectRenderingInfo> getEditorHeroSpritesPerTile( const Tile & tile, fheroes2::MemoryArena & arena )
     {
         assert( tile.getMainObjectType() == MP2::OBJ_HERO );
 
@@ -1312,16 +1252,8 @@ namespace Maps
 
         const fheroes2::Point boatSpriteOffset{ 0, 32 - 50 };
 
-        std::vector<fheroes2::Point> outputSquareInfo;
-        std::vector<std::pair<fheroes2::Point, fheroes2::Rect>> outputImageInfo;
-        fheroes2::DivideImageBySquares( boatSpriteOffset, boatSprite, fheroes2::tileWidthPx, outputSquareInfo, outputImageInfo );
-
-        assert( outputSquareInfo.size() == outputImageInfo.size() );
-
-        std::vector<fheroes2::ObjectRenderingInfo> objectInfo;
-        for ( size_t i = 0; i < outputSquareInfo.size(); ++i ) {
-            objectInfo.emplace_back( outputSquareInfo[i], outputImageInfo[i].first, outputImageInfo[i].second, icnId, icnIndex, false, static_cast<uint8_t>( 255 ) );
-        }
+        fheroes2::ArenaVector<fheroes2::ObjectRenderingInfo> objectInfo( fheroes2::ArenaAllocator<fheroes2::ObjectRenderingInfo>{ arena } );
+        addSpriteSquares( objectInfo, boatSpriteOffset, boatSprite, icnId, icnIndex, false );
 
         return objectInfo;
     }
@@ -1330,4 +1262,70 @@ namespace Maps
     {
         return fheroes2::AGG::GetTIL( TIL::GROUND32, tile.getTerrainImageIndex(), ( tile.getTerrainFlags() & 0x3 ) );
     }
+
+    bool redrawStaticTerrain( const Tile & tile, fheroes2::Image & dst, const fheroes2::Point & pos )
+    {
+        const fheroes2::Image & surface = getTileSurface( tile );
+        fheroes2::Copy( surface, 0, 0, dst, pos.x, pos.y, surface.width(), surface.height() );
+
+        if ( isTerrainLayerAnimated( tile ) ) {
+            return false;
+        }
+
+        // The order of rendering is the same as in redrawBottomLayerObjects(): ground object parts, the main object and flags.
+        for ( const auto & part : tile.getGroundObjectParts() ) {
+            if ( part.layerType != TERRAIN_LAYER || part.icnType == MP2::OBJ_ICN_TYPE_FLAG32 ) {
+                continue;
+            }
+
+            const int icn = MP2::getIcnIdFromObjectIcnType( part.icnType );
+            if ( !isObjectPartDirectRenderingRestricted( icn ) ) {
+                renderStaticObjectPart( dst, pos, icn, part.icnIndex );
+            }
+        }
+
+        const auto & mainPart = tile.getMainObjectPart();
+        if ( mainPart.icnType != MP2::OBJ_ICN_TYPE_UNKNOWN && mainPart.layerType == TERRAIN_LAYER ) {
+            const int icn = MP2::getIcnIdFromObjectIcnType( mainPart.icnType );
+            if ( !isTileDirectRenderingRestricted( icn, tile.getMainObjectType() ) ) {
+                renderStaticObjectPart( dst, pos, icn, mainPart.icnIndex );
+            }
+        }
+
+        for ( const auto & part : tile.getGroundObjectParts() ) {
+            if ( part.layerType == TERRAIN_LAYER && part.icnType == MP2::OBJ_ICN_TYPE_FLAG32 ) {
+                renderStaticObjectPart( dst, pos, MP2::getIcnIdFromObjectIcnType( part.icnType ), part.icnIndex );
+            }
+        }
+
+        return true;
+    }
+
+    uint64_t getStaticTerrainSignature( const Tile & tile )
+    {
+        // FNV-1a hash of everything what affects the result of redrawStaticTerrain().
+        uint64_t signature = 14695981039346656037ULL;
+
+        const auto addValue = [&signature]( const uint32_t value ) {
+            signature ^= value;
+            signature *= 1099511628211ULL;
+        };
+
+        addValue( tile.getTerrainImageIndex() );
+        addValue( tile.getTerrainFlags() & 0x3 );
+
+        for ( const auto & part : tile.getGroundObjectParts() ) {
+            if ( part.layerType == TERRAIN_LAYER ) {
+                addValue( ( static_cast<uint32_t>( part.icnType ) << 8 ) | part.icnIndex );
+            }
+        }
+
+        const auto & mainPart = tile.getMainObjectPart();
+        if ( mainPart.icnType != MP2::OBJ_ICN_TYPE_UNKNOWN && mainPart.layerType == TERRAIN_LAYER ) {
+            addValue( ( static_cast<uint32_t>( mainPart.icnType ) << 8 ) | mainPart.icnIndex );
+            addValue( tile.getMainObjectType() );
+        }
+
+        return signature;
+    }
 }
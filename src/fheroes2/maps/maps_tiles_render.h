@@ -21,10 +21,10 @@
 #pragma once
 
 #include <cstdint>
-#include <vector>
 
 #include "color.h"
 #include "math_base.h"
+#include "memory_arena.h"
 
 class Heroes;
 
@@ -63,14 +63,23 @@ namespace Maps
 
     void drawByObjectIcnType( const Tile & tile, fheroes2::Image & output, const Interface::GameArea & area, const MP2::ObjectIcnType objectIcnType );
 
-    std::vector<fheroes2::ObjectRenderingInfo> getMonsterSpritesPerTile( const Tile & tile, const bool isEditorMode );
-    std::vector<fheroes2::ObjectRenderingInfo> getMonsterShadowSpritesPerTile( const Tile & tile, const bool isEditorMode );
-    std::vector<fheroes2::ObjectRenderingInfo> getBoatSpritesPerTile( const Tile & tile );
-    std::vector<fheroes2::ObjectRenderingInfo> getBoatShadowSpritesPerTile( const Tile & tile );
-    std::vector<fheroes2::ObjectRenderingInfo> getMineGuardianSpritesPerTile( const Tile & tile );
-    std::vector<fheroes2::ObjectRenderingInfo> getHeroSpritesPerTile( const Heroes & hero );
-    std::vector<fheroes2::ObjectRenderingInfo> getHeroShadowSpritesPerTile( const Heroes & hero );
-    std::vector<fheroes2::ObjectRenderingInfo> getEditorHeroSpritesPerTile( const Tile & tile );
+    // Rendering information of tile-unfit objects is allocated from the given arena.
+    fheroes2::ArenaVector<fheroes2::ObjectRenderingInfo> getMonsterSpritesPerTile( const Tile & tile, const bool isEditorMode, fheroes2::MemoryArena & arena );
+    fheroes2::ArenaVector<fheroes2::ObjectRenderingInfo> getMonsterShadowSpritesPerTile( const Tile & tile, const bool isEditorMode, fheroes2::MemoryArena & arena );
+    fheroes2::ArenaVector<fheroes2::ObjectRenderingInfo> getBoatSpritesPerTile( const Tile & tile, fheroes2::MemoryArena & arena );
+    fheroes2::ArenaVector<fheroes2::ObjectRenderingInfo> getBoatShadowSpritesPerTile( const Tile & tile, fheroes2::MemoryArena & arena );
+    fheroes2::ArenaVector<fheroes2::ObjectRenderingInfo> getMineGuardianSpritesPerTile( const Tile & tile, fheroes2::MemoryArena & arena );
+    fheroes2::ArenaVector<fheroes2::ObjectRenderingInfo> getHeroSpritesPerTile( const Heroes & hero, fheroes2::MemoryArena & arena );
+    fheroes2::ArenaVector<fheroes2::ObjectRenderingInfo> getHeroShadowSpritesPerTile( const Heroes & hero, fheroes2::MemoryArena & arena );
+    fheroes2::ArenaVector<fheroes2::ObjectRenderingInfo> getEditorHeroSpritesPerTile( const Tile & tile, fheroes2::MemoryArena & arena );
 
     const fheroes2::Image & getTileSurface( const Tile & tile );
+
+    // Renders the terrain image of the tile together with its terrain layer objects (roads, rivers and cracks) at the given position of the image
+    // ignoring fog and fading animations. If some terrain layer objects are animated only the terrain image is rendered and false is returned:
+    // the objects have to be rendered by redrawBottomLayerObjects() for every frame.
+    bool redrawStaticTerrain( const Tile & tile, fheroes2::Image & dst, const fheroes2::Point & pos );
+
+    // Returns a value which changes whenever the result of redrawStaticTerrain() for the tile changes.
+    uint64_t getStaticTerrainSignature( const Tile & tile );
 }
@@ -23,6 +23,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <cstdlib>
 #include <sstream>
 #include <utility>
@@ -31,6 +32,7 @@
 #include <CoreFoundation/CoreFoundation.h>
 #endif
 
+#include "agg_image.h"
 #include "cursor.h"
 #include "difficulty.h"
 #include "game.h"
@@ -92,6 +94,13 @@ namespace
     };
 
     const int defaultSpeedDelay{ 5 };
+
+#if defined( TARGET_PS_VITA ) || defined( TARGET_NINTENDO_SWITCH ) || defined( __EMSCRIPTEN__ )
+    // Memory is limited on these platforms so loaded images should not occupy all of it during long game sessions.
+    const int defaultImageCacheSize{ 64 };
+#else
+    const int defaultImageCacheSize{ 0 };
+#endif
 }
 
 std::string Settings::GetVersion()
@@ -108,6 +117,7 @@ Settings::Settings()
     , music_volume( 6 )
     , _musicType( MUSIC_EXTERNAL )
     , _controllerPointerSpeed( 10 )
+    , _imageCacheSize( defaultImageCacheSize )
     , heroes_speed( defaultSpeedDelay )
     , ai_speed( defaultSpeedDelay )
     , scroll_speed( SCROLL_SPEED_NORMAL )
@@ -320,6 +330,12 @@ bool Settings::Read( const std::string & filePath )
         _controllerPointerSpeed = std::clamp( config.IntParams( "controller pointer speed" ), 0, 100 );
     }
 
+    if ( config.Exists( "image cache size" ) ) {
+        _imageCacheSize = std::max( config.IntParams( "image cache size" ), 0 );
+    }
+
+    fheroes2::AGG::setImageCacheLimit( static_cast<size_t>( _imageCacheSize ) * 1024 * 1024 );
+
     if ( config.Exists( "first time game run" ) && config.StrParams( "first time game run" ) == "off" ) {
         resetFirstGameRun();
     }
@@ -551,6 +567,9 @@ std::string Settings::String() const
     os << std::endl << "# Controller pointer speed: 0 - 100" << std::endl;
     os << "controller pointer speed = " << _controllerPointerSpeed << std::endl;
 
+    os << std::endl << "# Maximum memory size of loaded game images in megabytes, 0 means no limit" << std::endl;
+    os << "image cache size = " << _imageCacheSize << std::endl;
+
     os << std::endl << "# First time game run (show additional hints): on/off" << std::endl;
     os << "first time game run = " << ( _gameOptions.Modes( GAME_FIRST_RUN ) ? "on" : "off" ) << std::endl;
 
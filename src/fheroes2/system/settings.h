@@ -458,6 +458,8 @@ private:
     int music_volume;
     MusicSource _musicType;
     int _controllerPointerSpeed;
+    // The maximum memory size of loaded images in megabytes. 0 means no limit.
+    int _imageCacheSize;
     int heroes_speed;
     int ai_speed;
     int scroll_speed;
@@ -26,6 +26,7 @@
 #include <algorithm>
 #include <array>
 #include <cassert>
+#include <functional>
 #include <limits>
 #include <optional>
 #include <ostream>
@@ -302,6 +303,9 @@ void World::Reset()
 
     // maps tiles
     vec_tiles.clear();
+    _objectIndex.clear();
+    _fog.clear();
+    clearRadarChangedTiles();
 
     // kingdoms
     vec_kingdoms.clear();
@@ -381,6 +385,8 @@ void World::generateUninitializedMap( const int32_t size )
     // The tiles are cleared and resizing their vector also initializes tiles with the default values.
     assert( vec_tiles.empty() );
     vec_tiles.resize( static_cast<size_t>( width ) * height );
+
+    _fog.build( vec_tiles );
 }
 
 const Castle * World::getCastleEntrance( const fheroes2::Point & tilePosition ) const
@@ -408,8 +414,9 @@ bool World::isValidCastleEntrance( const fheroes2::Point & tilePosition ) const
 
 const Week & World::GetWeekType() const
 {
-    static auto cachedWeekDependencies = std::make_tuple( _week, GetWeekSeed() );
-    static Week cachedWeek = Week::RandomWeek( FirstWeek(), GetWeekSeed() );
+    // The type of the week can be requested by several AI threads at the same time, so every thread has its own cache.
+    thread_local auto cachedWeekDependencies = std::make_tuple( _week, GetWeekSeed() );
+    thread_local Week cachedWeek = Week::RandomWeek( FirstWeek(), GetWeekSeed() );
 
     const auto currentWeekDependencies = std::make_tuple( _week, GetWeekSeed() );
 
@@ -892,7 +899,7 @@ std::string World::DateString() const
 
 uint32_t World::CountObeliskOnMaps()
 {
-    const size_t res = std::count_if( vec_tiles.begin(), vec_tiles.end(), []( const Maps::Tile & tile ) { return MP2::OBJ_OBELISK == tile.getMainObjectType( false ); } );
+    const size_t res = Maps::GetObjectPositions( MP2::OBJ_OBELISK ).size();
     return res > 0 ? static_cast<uint32_t>( res ) : 6;
 }
 
@@ -1156,7 +1163,7 @@ uint32_t World::getDistance( const Heroes & hero, int targetIndex )
     return _pathfinder.getDistance( targetIndex );
 }
 
-std::list<Route::Step> World::getPath( const Heroes & hero, int targetIndex )
+std::vector<Route::Step> World::getPath( const Heroes & hero, int targetIndex )
 {
     _pathfinder.reEvaluateIfNeeded( hero );
     return _pathfinder.buildPath( targetIndex );
@@ -1168,6 +1175,68 @@ void World::resetPathfinder()
     AI::Planner::Get().resetPathfinder();
 }
 
+void World::invalidatePathfinderTile( const int32_t tileIndex )
+{
+    _pathfinder.invalidateTile( tileIndex );
+    AI::Planner::Get().invalidatePathfinderTile( tileIndex );
+
+    markRadarTileChanged( tileIndex );
+}
+
+void World::markRadarTileChanged( const int32_t tileIndex )
+{
+    if ( tileIndex < 0 || static_cast<size_t>( tileIndex ) >= vec_tiles.size() ) {
+        return;
+    }
+
+    if ( _isRadarTileChanged.size() != vec_tiles.size() ) {
+        _isRadarTileChanged.assign( vec_tiles.size(), 0 );
+    }
+
+    if ( _isRadarTileChanged[tileIndex] ) {
+        return;
+    }
+
+    _isRadarTileChanged[tileIndex] = 1;
+    _radarChangedTiles.push_back( tileIndex );
+}
+
+void World::markRadarAreaChanged( const fheroes2::Rect & area )
+{
+    const fheroes2::Rect worldArea = area ^ fheroes2::Rect( 0, 0, width, height );
+
+    for ( int32_t y = worldArea.y; y < worldArea.y + worldArea.height; ++y ) {
+        for ( int32_t x = worldArea.x; x < worldArea.x + worldArea.width; ++x ) {
+            markRadarTileChanged( y * width + x );
+        }
+    }
+}
+
+void World::clearRadarChangedTiles()
+{
+    for ( const int32_t tileIndex : _radarChangedTiles ) {
+        _isRadarTileChanged[tileIndex] = 0;
+    }
+
+    _radarChangedTiles.clear();
+}
+
+bool World::isWorldTile( const Maps::Tile & tile ) const
+{
+    const int32_t tileIndex = tile.GetIndex();
+
+    return tileIndex >= 0 && static_cast<size_t>( tileIndex ) < vec_tiles.size() && &vec_tiles[tileIndex] == &tile;
+}
+
+void World::updateObjectIndex( const Maps::Tile & tile, const MP2::MapObjectType previousObjectType )
+{
+    if ( !isWorldTile( tile ) ) {
+        return;
+    }
+
+    _objectIndex.updateTile( tile.GetIndex(), previousObjectType, tile.getMainObjectType() );
+}
+
 void World::updatePassabilities()
 {
     for ( Maps::Tile & tile : vec_tiles ) {
@@ -1187,6 +1256,12 @@ void World::updatePassabilities()
 
 void World::PostLoad( const bool setTilePassabilities, const bool updateUidCounterToMaximum )
 {
+    // Object types of tiles read from a save file are not set one by one, so the index has to be built from scratch.
+    _objectIndex.build( vec_tiles );
+
+    // The same applies to fog bitplanes.
+    _fog.build( vec_tiles );
+
     if ( setTilePassabilities ) {
         updatePassabilities();
     }
@@ -1439,10 +1514,52 @@ IStreamBase & operator>>( IStreamBase & stream, MapObjects & objs )
     return stream;
 }
 
+void World::serialize( OStreamBase & stream, const std::function<void()> & onEntityStart ) const
+{
+    const auto markEntityStart = [&onEntityStart]() {
+        if ( onEntityStart ) {
+            onEntityStart();
+        }
+    };
+
+    stream << width << height;
+
+    // Tiles, heroes and castles are written in the same way as the corresponding containers are serialized.
+    stream.put32( static_cast<uint32_t>( vec_tiles.size() ) );
+
+    for ( const Maps::Tile & tile : vec_tiles ) {
+        markEntityStart();
+        stream << tile;
+    }
+
+    stream.put32( static_cast<uint32_t>( vec_heroes.size() ) );
+
+    for ( const Heroes * hero : vec_heroes ) {
+        markEntityStart();
+        stream << *hero;
+    }
+
+    stream.put32( static_cast<uint32_t>( vec_castles.Size() ) );
+
+    for ( const Castle * castle : vec_castles ) {
+        markEntityStart();
+        stream << *castle;
+    }
+
+    vec_kingdoms.serialize( stream, onEntityStart );
+
+    // Everything else is treated as a single entity.
+    markEntityStart();
+
+    stream << _customRumors << vec_eventsday << map_captureobj << _ultimateArtifact << _day << _week << _month << heroIdAsWinCondition << heroIdAsLossCondition
+           << map_objects << _seed;
+}
+
 OStreamBase & operator<<( OStreamBase & stream, const World & w )
 {
-    return stream << w.width << w.height << w.vec_tiles << w.vec_heroes << w.vec_castles << w.vec_kingdoms << w._customRumors << w.vec_eventsday << w.map_captureobj
-                  << w._ultimateArtifact << w._day << w._week << w._month << w.heroIdAsWinCondition << w.heroIdAsLossCondition << w.map_objects << w._seed;
+    w.serialize( stream, {} );
+
+    return stream;
 }
 
 IStreamBase & operator>>( IStreamBase & stream, World & w )
@@ -25,6 +25,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <list>
 #include <map>
 #include <memory>
@@ -47,6 +48,8 @@
 #include "monster.h"
 #include "pairs.h"
 #include "resource.h"
+#include "world_fog.h"
+#include "world_object_index.h"
 #include "world_pathfinding.h"
 #include "world_regions.h"
 
@@ -496,8 +499,50 @@ public:
     }
 
     uint32_t getDistance( const Heroes & hero, int targetIndex );
-    std::list<Route::Step> getPath( const Heroes & hero, int targetIndex );
+    std::vector<Route::Step> getPath( const Heroes & hero, int targetIndex );
     void resetPathfinder();
+    // Notifies all pathfinders that the state of the given tile has been changed, so only the affected part of their caches is re-evaluated.
+    void invalidatePathfinderTile( const int32_t tileIndex );
+
+    const WorldObjectIndex & getObjectIndex() const
+    {
+        return _objectIndex;
+    }
+
+    // Returns true if the given tile is a part of the world and not a temporary copy (for example, one created while reading map headers).
+    // Such copies must not notify the world about their changes as they can be modified by other threads.
+    bool isWorldTile( const Maps::Tile & tile ) const;
+
+    // Updates the object index after the main object type of the given tile has been changed.
+    // Tiles which are not a part of the world are ignored.
+    void updateObjectIndex( const Maps::Tile & tile, const MP2::MapObjectType previousObjectType );
+
+    // Fog checks for many tiles (scouting, AI exploration) should use this data instead of accessing tiles one by one.
+    const WorldFog & getFog() const
+    {
+        return _fog;
+    }
+
+    // Updates the fog bitplanes after fog of the given tile has been cleared. Call it only from Maps::Tile::ClearFog().
+    void clearTileFog( const int32_t tileIndex, const PlayerColorsSet colors )
+    {
+        _fog.clearFog( tileIndex, colors );
+
+        markRadarTileChanged( tileIndex );
+    }
+
+    // Marks the given tile (or all tiles of the given area) as the one that might look different on the radar map.
+    // Tiles which are not a part of the world are ignored.
+    void markRadarTileChanged( const int32_t tileIndex );
+    void markRadarAreaChanged( const fheroes2::Rect & area );
+
+    // Returns the tiles that might look different on the radar map since the last call of clearRadarChangedTiles().
+    const std::vector<int32_t> & getRadarChangedTiles() const
+    {
+        return _radarChangedTiles;
+    }
+
+    void clearRadarChangedTiles();
 
     void ComputeStaticAnalysis();
 
@@ -521,6 +566,10 @@ public:
     // Call this method only when loading maps made with original French editor.
     void fixFrenchCharactersInStrings();
 
+    // Serializes the world in the same way as operator<< does, calling the given function (if set) before every tile, hero,
+    // castle and kingdom. This allows to find out which parts of the serialized data belong to the individual map entities.
+    void serialize( OStreamBase & stream, const std::function<void()> & onEntityStart ) const;
+
 private:
     World() = default;
 
@@ -579,6 +628,12 @@ private:
     std::map<uint8_t, Maps::Indexes> _allTeleports; // All indexes of tiles that contain stone liths of a certain type (sprite index)
     std::map<uint8_t, Maps::Indexes> _allWhirlpools; // All indexes of tiles that contain a certain part (sprite index) of the whirlpool
     std::vector<int32_t> _allEyeOfMagi;
+    WorldObjectIndex _objectIndex;
+    WorldFog _fog;
+
+    // Tiles that might look different on the radar map, every tile is listed only once.
+    std::vector<int32_t> _radarChangedTiles;
+    std::vector<uint8_t> _isRadarTileChanged;
 
     uint8_t _waterPercentage{ 0 };
     double _landRoughness{ 1.0 };
@@ -0,0 +1,90 @@
+/***************************************************************************
+ *   fheroes2: https://github.com/ihhub/fheroes2                           *
+ *   Copyright (C) 2026                                                    *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include "world_fog.h"
+
+#include "maps_tiles.h"
+
+void WorldFog::build( const std::vector<Maps::Tile> & tiles )
+{
+    _tileCount = static_cast<int32_t>( tiles.size() );
+
+    const size_t wordCount = ( tiles.size() + bitsPerWord - 1 ) / bitsPerWord;
+
+    for ( int planeIndex = 0; planeIndex < maxPlanes; ++planeIndex ) {
+        std::vector<uint64_t> & plane = _planes[planeIndex];
+        plane.assign( wordCount, 0 );
+
+        const PlayerColor color = static_cast<PlayerColor>( 1 << planeIndex );
+
+        for ( int32_t tileIndex = 0; tileIndex < _tileCount; ++tileIndex ) {
+            if ( tiles[tileIndex].isFog( color ) ) {
+                plane[_getWordIndex( tileIndex )] |= _getBit( tileIndex );
+            }
+        }
+    }
+}
+
+bool WorldFog::isFog( const int32_t tileIndex, const PlayerColorsSet colors ) const
+{
+    if ( !_isValidTileIndex( tileIndex ) ) {
+        return false;
+    }
+
+    const uint64_t bit = _getBit( tileIndex );
+    return ( _getFogWord( _getWordIndex( tileIndex ), colors ) & bit ) != 0;
+}
+
+void WorldFog::clearFog( const int32_t tileIndex, const PlayerColorsSet colors )
+{
+    if ( !_isValidTileIndex( tileIndex ) ) {
+        return;
+    }
+
+    const size_t wordIndex = _getWordIndex( tileIndex );
+    const uint64_t bit = _getBit( tileIndex );
+
+    for ( int planeIndex = 0; planeIndex < maxPlanes; ++planeIndex ) {
+        if ( colors & ( 1 << planeIndex ) ) {
+            _planes[planeIndex][wordIndex] &= ~bit;
+        }
+    }
+}
+
+int32_t WorldFog::countFog( const int32_t firstTileIndex, const int32_t lastTileIndex, const PlayerColor color ) const
+{
+    assert( firstTileIndex <= lastTileIndex && _isValidTileIndex( firstTileIndex ) && _isValidTileIndex( lastTileIndex ) );
+
+    const int planeIndex = _getPlaneIndex( color );
+    if ( planeIndex < 0 ) {
+        return 0;
+    }
+
+    const std::vector<uint64_t> & plane = _planes[planeIndex];
+    const size_t lastWordIndex = _getWordIndex( lastTileIndex );
+
+    int32_t count = 0;
+
+    for ( size_t wordIndex = _getWordIndex( firstTileIndex ); wordIndex <= lastWordIndex; ++wordIndex ) {
+        count += _countBits( plane[wordIndex] & _getSpanMask( wordIndex, firstTileIndex, lastTileIndex ) );
+    }
+
+    return count;
+}
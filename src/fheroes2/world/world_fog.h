@@ -0,0 +1,171 @@
+/***************************************************************************
+ *   fheroes2: https://github.com/ihhub/fheroes2                           *
+ *   Copyright (C) 2026                                                    *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "color.h"
+
+namespace Maps
+{
+    class Tile;
+}
+
+// Fog of war of every player color stored as one bit per tile (a bitplane) where the bit index is the tile index.
+// Fog of a horizontal span of tiles is checked, counted or cleared by 64-bit word operations without accessing the tiles.
+// Fog colors of tiles are a view of this data which is used for rendering and saving, so both must be updated together.
+class WorldFog final
+{
+public:
+    void clear()
+    {
+        for ( std::vector<uint64_t> & plane : _planes ) {
+            plane.clear();
+        }
+
+        _tileCount = 0;
+    }
+
+    // Builds the bitplanes from scratch using fog colors of the given world tiles.
+    void build( const std::vector<Maps::Tile> & tiles );
+
+    // Returns true if the tile is covered by fog for the given color.
+    bool isFog( const int32_t tileIndex, const PlayerColor color ) const
+    {
+        const int planeIndex = _getPlaneIndex( color );
+        if ( planeIndex < 0 || !_isValidTileIndex( tileIndex ) ) {
+            return false;
+        }
+
+        return ( _planes[planeIndex][_getWordIndex( tileIndex )] & _getBit( tileIndex ) ) != 0;
+    }
+
+    // Returns true if the tile is covered by fog for all given colors, the same as Maps::Tile::isFog() does.
+    bool isFog( const int32_t tileIndex, const PlayerColorsSet colors ) const;
+
+    // Clears fog of the given colors for a single tile. Tiles which are not a part of the world are ignored.
+    void clearFog( const int32_t tileIndex, const PlayerColorsSet colors );
+
+    // Returns the number of tiles in the [firstTileIndex, lastTileIndex] range covered by fog for the given color.
+    int32_t countFog( const int32_t firstTileIndex, const int32_t lastTileIndex, const PlayerColor color ) const;
+
+    // Calls function( tileIndex ) for every tile in the [firstTileIndex, lastTileIndex] range covered by fog for all given colors.
+    // The function is allowed to clear fog of the visited tiles.
+    template <typename Function>
+    void forEachFogTile( const int32_t firstTileIndex, const int32_t lastTileIndex, const PlayerColorsSet colors, Function function ) const
+    {
+        assert( colors != 0 && firstTileIndex <= lastTileIndex && _isValidTileIndex( firstTileIndex ) && _isValidTileIndex( lastTileIndex ) );
+
+        const size_t lastWordIndex = _getWordIndex( lastTileIndex );
+
+        for ( size_t wordIndex = _getWordIndex( firstTileIndex ); wordIndex <= lastWordIndex; ++wordIndex ) {
+            uint64_t word = _getSpanMask( wordIndex, firstTileIndex, lastTileIndex ) & _getFogWord( wordIndex, colors );
+
+            while ( word != 0 ) {
+                const uint64_t lowestBit = word & ( ~word + 1 );
+                word ^= lowestBit;
+
+                function( static_cast<int32_t>( wordIndex * bitsPerWord ) + _countBits( lowestBit - 1 ) );
+            }
+        }
+    }
+
+private:
+    // Every player color has its own bitplane. The index of a bitplane is the index of the color bit.
+    static constexpr int maxPlanes{ 6 };
+    static constexpr size_t bitsPerWord{ 64 };
+
+    static_assert( Color::allPlayerColors() == ( 1 << maxPlanes ) - 1 );
+
+    std::array<std::vector<uint64_t>, maxPlanes> _planes;
+
+    int32_t _tileCount{ 0 };
+
+    bool _isValidTileIndex( const int32_t tileIndex ) const
+    {
+        return tileIndex >= 0 && tileIndex < _tileCount;
+    }
+
+    static size_t _getWordIndex( const int32_t tileIndex )
+    {
+        return static_cast<size_t>( tileIndex ) / bitsPerWord;
+    }
+
+    static uint64_t _getBit( const int32_t tileIndex )
+    {
+        return uint64_t{ 1 } << ( static_cast<size_t>( tileIndex ) % bitsPerWord );
+    }
+
+    // Returns the bits of the given word which belong to the [firstTileIndex, lastTileIndex] range.
+    static uint64_t _getSpanMask( const size_t wordIndex, const int32_t firstTileIndex, const int32_t lastTileIndex )
+    {
+        uint64_t mask = ~uint64_t{ 0 };
+
+        if ( wordIndex == _getWordIndex( firstTileIndex ) ) {
+            mask &= ~( _getBit( firstTileIndex ) - 1 );
+        }
+
+        if ( wordIndex == _getWordIndex( lastTileIndex ) ) {
+            const uint64_t lastBit = _getBit( lastTileIndex );
+            mask &= lastBit | ( lastBit - 1 );
+        }
+
+        return mask;
+    }
+
+    // Returns the bits of the given word where all given colors have fog.
+    uint64_t _getFogWord( const size_t wordIndex, const PlayerColorsSet colors ) const
+    {
+        uint64_t word = ~uint64_t{ 0 };
+
+        for ( int planeIndex = 0; planeIndex < maxPlanes; ++planeIndex ) {
+            if ( colors & ( 1 << planeIndex ) ) {
+                word &= _planes[planeIndex][wordIndex];
+            }
+        }
+
+        return word;
+    }
+
+    // Returns -1 if the value is not a single player color.
+    static int _getPlaneIndex( const PlayerColor color )
+    {
+        const uint64_t value = static_cast<uint64_t>( color );
+        if ( value == 0 || ( value & ( value - 1 ) ) != 0 || ( value & Color::allPlayerColors() ) == 0 ) {
+            return -1;
+        }
+
+        return _countBits( value - 1 );
+    }
+
+    static int32_t _countBits( uint64_t value )
+    {
+        // A branchless population count (SWAR), portable across all supported compilers.
+        value = value - ( ( value >> 1 ) & 0x5555555555555555ULL );
+        value = ( value & 0x3333333333333333ULL ) + ( ( value >> 2 ) & 0x3333333333333333ULL );
+        value = ( value + ( value >> 4 ) ) & 0x0F0F0F0F0F0F0F0FULL;
+        return static_cast<int32_t>( ( value * 0x0101010101010101ULL ) >> 56 );
+    }
+};
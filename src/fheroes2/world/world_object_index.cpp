@@ -0,0 +1,138 @@
+/***************************************************************************
+ *   fheroes2: https://github.com/ihhub/fheroes2                           *
+ *   Copyright (C) 2026                                                    *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include "world_object_index.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+
+#include "maps_tiles.h"
+#include "mp2.h"
+
+void WorldObjectIndex::build( const std::vector<Maps::Tile> & tiles )
+{
+    _tilesByObjectType.clear();
+
+    for ( const Maps::Tile & tile : tiles ) {
+        const MP2::MapObjectType objectType = tile.getMainObjectType();
+        if ( objectType == MP2::OBJ_NONE ) {
+            continue;
+        }
+
+        if ( _tilesByObjectType.size() <= static_cast<size_t>( objectType ) ) {
+            _tilesByObjectType.resize( static_cast<size_t>( objectType ) + 1 );
+        }
+
+        // Tiles are processed in ascending order so the lists stay sorted.
+        _tilesByObjectType[objectType].push_back( tile.GetIndex() );
+    }
+}
+
+void WorldObjectIndex::updateTile( const int32_t tileIndex, const MP2::MapObjectType previousObjectType, const MP2::MapObjectType newObjectType )
+{
+    if ( previousObjectType == newObjectType ) {
+        return;
+    }
+
+    if ( previousObjectType != MP2::OBJ_NONE && static_cast<size_t>( previousObjectType ) < _tilesByObjectType.size() ) {
+        std::vector<int32_t> & objectTiles = _tilesByObjectType[previousObjectType];
+
+        const auto iter = std::lower_bound( objectTiles.begin(), objectTiles.end(), tileIndex );
+        if ( iter != objectTiles.end() && *iter == tileIndex ) {
+            objectTiles.erase( iter );
+        }
+    }
+
+    if ( newObjectType == MP2::OBJ_NONE ) {
+        return;
+    }
+
+    if ( _tilesByObjectType.size() <= static_cast<size_t>( newObjectType ) ) {
+        _tilesByObjectType.resize( static_cast<size_t>( newObjectType ) + 1 );
+    }
+
+    std::vector<int32_t> & objectTiles = _tilesByObjectType[newObjectType];
+
+    // While a map is being loaded tiles are added in ascending order, so this is a cheap insertion at the end.
+    const auto iter = std::lower_bound( objectTiles.begin(), objectTiles.end(), tileIndex );
+    if ( iter == objectTiles.end() || *iter != tileIndex ) {
+        objectTiles.insert( iter, tileIndex );
+    }
+}
+
+const std::vector<int32_t> & WorldObjectIndex::getObjectTiles( const MP2::MapObjectType objectType ) const
+{
+    assert( objectType != MP2::OBJ_NONE );
+
+    if ( static_cast<size_t>( objectType ) >= _tilesByObjectType.size() ) {
+        static const std::vector<int32_t> noTiles;
+        return noTiles;
+    }
+
+    return _tilesByObjectType[objectType];
+}
+
+std::vector<int32_t> WorldObjectIndex::getObjectTilesAround( const int32_t center, const int32_t distance, const MP2::MapObjectType objectType,
+                                                             const int32_t width, const int32_t height ) const
+{
+    assert( width > 0 && height > 0 );
+
+    if ( center < 0 || center >= width * height || distance < 1 ) {
+        return {};
+    }
+
+    const std::vector<int32_t> & objectTiles = getObjectTiles( objectType );
+    if ( objectTiles.empty() ) {
+        return {};
+    }
+
+    const int32_t centerX = center % width;
+    const int32_t centerY = center / width;
+
+    const int32_t minX = std::max( centerX - distance, 0 );
+    const int32_t maxX = std::min( centerX + distance, width - 1 );
+    const int32_t minY = std::max( centerY - distance, 0 );
+    const int32_t maxY = std::min( centerY + distance, height - 1 );
+
+    std::vector<int32_t> result;
+
+    auto iter = objectTiles.begin();
+
+    for ( int32_t y = minY; y <= maxY; ++y ) {
+        // Tiles of every row of the area form a continuous range of indexes, so they can be found using a binary search.
+        const int32_t rowBegin = y * width + minX;
+        const int32_t rowEnd = y * width + maxX;
+
+        iter = std::lower_bound( iter, objectTiles.end(), rowBegin );
+
+        for ( ; iter != objectTiles.end() && *iter <= rowEnd; ++iter ) {
+            if ( *iter != center ) {
+                result.push_back( *iter );
+            }
+        }
+
+        if ( iter == objectTiles.end() ) {
+            break;
+        }
+    }
+
+    return result;
+}
@@ -0,0 +1,64 @@
+/***************************************************************************
+ *   fheroes2: https://github.com/ihhub/fheroes2                           *
+ *   Copyright (C) 2026                                                    *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace Maps
+{
+    class Tile;
+}
+
+namespace MP2
+{
+    enum MapObjectType : uint16_t;
+}
+
+// Index of world tiles by the type of their main object. It allows to find all objects of a certain type
+// without going through all tiles of the map.
+class WorldObjectIndex final
+{
+public:
+    void clear()
+    {
+        _tilesByObjectType.clear();
+    }
+
+    // Builds the index from scratch using the given world tiles.
+    void build( const std::vector<Maps::Tile> & tiles );
+
+    // Moves the tile from the list of the previous object type to the list of the new object type.
+    void updateTile( const int32_t tileIndex, const MP2::MapObjectType previousObjectType, const MP2::MapObjectType newObjectType );
+
+    // Returns the indexes of all tiles with the main object of the given type in ascending order.
+    // Tiles without objects (OBJ_NONE) are not indexed.
+    const std::vector<int32_t> & getObjectTiles( const MP2::MapObjectType objectType ) const;
+
+    // Returns the indexes of tiles with the main object of the given type located within the given distance from the center tile
+    // in ascending order. The center tile itself is not included, the same as for Maps::getAroundIndexes().
+    std::vector<int32_t> getObjectTilesAround( const int32_t center, const int32_t distance, const MP2::MapObjectType objectType, const int32_t width,
+                                               const int32_t height ) const;
+
+private:
+    // Sorted indexes of tiles for every object type.
+    std::vector<std::vector<int32_t>> _tilesByObjectType;
+};
@@ -52,6 +52,7 @@
 #include "spell_info.h"
 #include "tools.h"
 #include "world.h"
+#include "world_fog.h"
 
 namespace
 {
@@ -80,8 +81,9 @@ namespace
         const MP2::MapObjectType objectType = tile.getMainObjectType();
 
         const auto isTileAccessible = [color, armyStrength, minimalAdvantage, &tile]() {
-            // Creating an Army instance is a relatively heavy operation, so cache it to speed up calculations
-            static Army tileArmy;
+            // Creating an Army instance is a relatively heavy operation, so cache it to speed up calculations. This function can be
+            // called by several AI threads at the same time, so every thread has its own instance.
+            thread_local Army tileArmy;
             tileArmy.setFromTile( tile );
 
             const PlayerColor tileArmyColor = tileArmy.GetColor();
@@ -320,13 +322,39 @@ namespace
         // This movement takes place on the same turn
         return movePoints - subtractedMovePoints;
     }
+
+    // States of the nodes used while repairing the pathfinder cache after the changes of the map
+    enum NodeRepairState : uint8_t
+    {
+        UNKNOWN,
+        // The path to this node does not depend on the changed tiles
+        VALID,
+        // Same as VALID, but the node is already in the list of nodes to explore
+        SEED,
+        // The node is located on or next to one of the changed tiles
+        CHANGED,
+        // The path to this node passes through a changed node
+        DEPENDENT
+    };
+
+    template <typename Calculator>
+    bool getCachedAIValue( uint8_t & cacheFlags, const uint8_t knownFlag, const uint8_t valueFlag, const Calculator & calculate )
+    {
+        if ( ( cacheFlags & knownFlag ) == 0 ) {
+            cacheFlags |= knownFlag;
+
+            if ( calculate() ) {
+                cacheFlags |= valueFlag;
+            }
+        }
+
+        return ( cacheFlags & valueFlag ) != 0;
+    }
 }
 
 uint32_t WorldPathfinder::getDistance( int targetIndex ) const
 {
-    assert( targetIndex >= 0 && static_cast<size_t>( targetIndex ) < _cache.size() );
-
-    return _cache[targetIndex]._cost;
+    return getNode( targetIndex )._cost;
 }
 
 uint32_t WorldPathfinder::getMovementPenalty( const int from, const int to, const int direction ) const
@@ -346,7 +374,7 @@ uint32_t WorldPathfinder::getMovementPenalty( const int from, const int to, cons
     // tile (both in straight and diagonal direction) as long as we have enough movement points
     // to move over our current tile in the straight direction
     if ( getMaxMovePoints( fromTile.isWater() ) > 0 ) {
-        const WorldNode & node = _cache[from];
+        const WorldNode & node = getNode( from );
 
         // No dead ends allowed
         assert( from == _pathStart || node._from != -1 );
@@ -382,34 +410,189 @@ void WorldPathfinder::reset()
         }
     }
 
+    _changedTiles.clear();
+
     _pathStart = -1;
     _color = PlayerColor::NONE;
     _remainingMovePoints = 0;
     _pathfindingSkill = Skill::Level::EXPERT;
 }
 
+void WorldPathfinder::invalidateTile( const int tileIndex )
+{
+    // There is nothing to repair if the cache is going to be evaluated from scratch anyway
+    if ( _pathStart == -1 ) {
+        return;
+    }
+
+    // The cache may still refer to the previous map while the new one is being loaded. If too many tiles have been changed,
+    // then it is cheaper to process the whole map again.
+    if ( _cache.size() != world.getSize() || _changedTiles.size() >= _cache.size() / 16 ) {
+        _changedTiles.clear();
+        _pathStart = -1;
+
+        return;
+    }
+
+    assert( tileIndex >= 0 && static_cast<size_t>( tileIndex ) < _cache.size() );
+
+    _changedTiles.push_back( tileIndex );
+}
+
+void WorldPathfinder::startNewGeneration()
+{
+    ++_generation;
+
+    // Once the generation counter wraps around, nodes from very old generations could be mistaken for the current
+    // ones, so all of them have to be reset explicitly.
+    if ( _generation == 0 ) {
+        for ( WorldNode & node : _cache ) {
+            node = {};
+        }
+
+        _generation = 1;
+    }
+
+    getNode( _pathStart ).update( -1, 0, _remainingMovePoints );
+
+    _nodesToExplore.clear();
+    _nodesToExplore.push_back( _pathStart );
+
+    _changedTiles.clear();
+}
+
 void WorldPathfinder::processWorldMap()
 {
     assert( _cache.size() == world.getSize() && Maps::isValidAbsIndex( _pathStart ) );
 
-    for ( WorldNode & node : _cache ) {
-        node = {};
+    startNewGeneration();
+
+    for ( size_t lastProcessedNode = 0; lastProcessedNode < _nodesToExplore.size(); ++lastProcessedNode ) {
+        processCurrentNode( _nodesToExplore, _nodesToExplore[lastProcessedNode] );
+    }
+}
+
+void WorldPathfinder::processWorldMapChanges()
+{
+    if ( _changedTiles.empty() ) {
+        return;
+    }
+
+    assert( _cache.size() == world.getSize() && Maps::isValidAbsIndex( _pathStart ) );
+
+    const auto & directions = Direction::allNeighboringDirections;
+
+    _nodeRepairStates.assign( _cache.size(), NodeRepairState::UNKNOWN );
+
+    // Both the passability of a tile and the ability to move to it from the neighboring tiles depend on the contents of
+    // the neighboring tiles (for example, monsters guard all the tiles around them), so the neighbors of the changed
+    // tiles are considered to be changed as well.
+    for ( const int tileIndex : _changedTiles ) {
+        _nodeRepairStates[tileIndex] = NodeRepairState::CHANGED;
+
+        for ( size_t i = 0; i < directions.size(); ++i ) {
+            if ( Maps::isValidDirection( tileIndex, directions[i] ) ) {
+                _nodeRepairStates[tileIndex + _mapOffset[i]] = NodeRepairState::CHANGED;
+            }
+        }
+    }
+
+    _changedTiles.clear();
+
+    // All paths start from the start tile, so nothing can be reused if it has been changed
+    if ( _nodeRepairStates[_pathStart] != NodeRepairState::UNKNOWN ) {
+        processWorldMap();
+        return;
+    }
+
+    _nodeRepairStates[_pathStart] = NodeRepairState::VALID;
+
+    // Determine the state of every node by walking up its path until a node with an already known state is found. The
+    // list of nodes to explore is used as a temporary storage for the visited part of the path.
+    for ( size_t idx = 0; idx < _cache.size(); ++idx ) {
+        _nodesToExplore.clear();
+
+        int nodeIdx = static_cast<int>( idx );
+
+        while ( _nodeRepairStates[nodeIdx] == NodeRepairState::UNKNOWN ) {
+            _nodesToExplore.push_back( nodeIdx );
+
+            nodeIdx = getNode( nodeIdx )._from;
+            if ( nodeIdx == -1 ) {
+                break;
+            }
+
+            // The path should not pass through the same tile more than once
+            assert( _nodesToExplore.size() <= _cache.size() );
+        }
+
+        // Unreachable nodes have nothing to repair
+        const uint8_t state = ( nodeIdx == -1 || _nodeRepairStates[nodeIdx] == NodeRepairState::VALID ) ? NodeRepairState::VALID : NodeRepairState::DEPENDENT;
+
+        for ( const int pathNodeIdx : _nodesToExplore ) {
+            _nodeRepairStates[pathNodeIdx] = state;
+        }
     }
 
-    _cache[_pathStart].update( -1, 0, _remainingMovePoints );
+    _nodesToRepair.clear();
 
-    std::vector<int> nodesToExplore;
-    nodesToExplore.push_back( _pathStart );
+    for ( size_t idx = 0; idx < _cache.size(); ++idx ) {
+        const uint8_t state = _nodeRepairStates[idx];
+        if ( state != NodeRepairState::CHANGED && state != NodeRepairState::DEPENDENT ) {
+            continue;
+        }
+
+        const int nodeIdx = static_cast<int>( idx );
+        WorldNode & node = getNode( nodeIdx );
+
+        node.reset();
+
+        // The cached AI checks of the changed tiles are no longer valid
+        if ( state == NodeRepairState::CHANGED ) {
+            node._aiCacheFlags = 0;
+        }
 
-    for ( size_t lastProcessedNode = 0; lastProcessedNode < nodesToExplore.size(); ++lastProcessedNode ) {
-        processCurrentNode( nodesToExplore, nodesToExplore[lastProcessedNode] );
+        _nodesToRepair.push_back( nodeIdx );
+    }
+
+    // The repair starts from all the valid nodes from which the invalidated nodes can be reached
+    _nodesToExplore.clear();
+
+    for ( const int nodeIdx : _nodesToRepair ) {
+        for ( size_t i = 0; i < directions.size(); ++i ) {
+            if ( Maps::isValidDirection( nodeIdx, directions[i] ) ) {
+                addRepairSeed( nodeIdx + _mapOffset[i] );
+            }
+        }
+
+        reconnectInvalidatedNode( nodeIdx );
+    }
+
+    for ( size_t lastProcessedNode = 0; lastProcessedNode < _nodesToExplore.size(); ++lastProcessedNode ) {
+        processCurrentNode( _nodesToExplore, _nodesToExplore[lastProcessedNode] );
     }
 }
 
+void WorldPathfinder::addRepairSeed( const int nodeIdx )
+{
+    assert( nodeIdx >= 0 && static_cast<size_t>( nodeIdx ) < _nodeRepairStates.size() );
+
+    if ( _nodeRepairStates[nodeIdx] != NodeRepairState::VALID ) {
+        return;
+    }
+
+    if ( nodeIdx != _pathStart && getNode( nodeIdx )._from == -1 ) {
+        return;
+    }
+
+    _nodeRepairStates[nodeIdx] = NodeRepairState::SEED;
+    _nodesToExplore.push_back( nodeIdx );
+}
+
 void WorldPathfinder::checkAdjacentNodes( std::vector<int> & nodesToExplore, const int currentNodeIdx )
 {
     const auto & directions = Direction::allNeighboringDirections;
-    const WorldNode & currentNode = _cache[currentNodeIdx];
+    const WorldNode & currentNode = getNode( currentNodeIdx );
     const uint32_t maxMovePoints = getMaxMovePoints( world.getTile( currentNodeIdx ).isWater() );
 
     for ( size_t i = 0; i < directions.size(); ++i ) {
@@ -425,7 +608,7 @@ void WorldPathfinder::checkAdjacentNodes( std::vector<int> & nodesToExplore, con
         const uint32_t movementPenalty = getMovementPenalty( currentNodeIdx, newIndex, directions[i] );
         const uint32_t movementCost = currentNode._cost + movementPenalty;
 
-        WorldNode & newNode = _cache[newIndex];
+        WorldNode & newNode = getNode( newIndex );
 
         if ( newNode._from == -1 || newNode._cost > movementCost ) {
             newNode.update( currentNodeIdx, movementCost, subtractMovePoints( currentNode._remainingMovePoints, movementPenalty, maxMovePoints ) );
@@ -458,41 +641,24 @@ void PlayerWorldPathfinder::reEvaluateIfNeeded( const Heroes & hero )
 
         processWorldMap();
     }
+    else {
+        processWorldMapChanges();
+    }
 }
 
-std::list<Route::Step> PlayerWorldPathfinder::buildPath( const int targetIndex ) const
+std::vector<Route::Step> PlayerWorldPathfinder::buildPath( const int targetIndex ) const
 {
     assert( _cache.size() == world.getSize() && Maps::isValidAbsIndex( _pathStart ) && Maps::isValidAbsIndex( targetIndex ) );
 
-    std::list<Route::Step> path;
+    std::vector<Route::Step> path;
 
-    // Destination is not reachable
-    if ( _cache[targetIndex]._cost == 0 ) {
-        return path;
-    }
-
-#ifndef NDEBUG
-    std::set<int> uniqPathIndexes;
-#endif
-
-    int currentNode = targetIndex;
-
-    while ( currentNode != _pathStart ) {
-        assert( currentNode != -1 );
-
-        const WorldNode & node = _cache[currentNode];
+    forEachPathStepBackwards( targetIndex, [this, &path]( const int currentNode, const int from ) {
+        const uint32_t cost = getNode( currentNode )._cost - getNode( from )._cost;
 
-        assert( node._from != -1 );
-
-        const uint32_t cost = node._cost - _cache[node._from]._cost;
-
-        path.emplace_front( currentNode, node._from, Maps::GetDirection( node._from, currentNode ), cost );
+        path.emplace_back( currentNode, from, Maps::GetDirection( from, currentNode ), cost );
+    } );
 
-        // The path should not pass through the same tile more than once
-        assert( uniqPathIndexes.insert( node._from ).second );
-
-        currentNode = node._from;
-    }
+    std::reverse( path.begin(), path.end() );
 
     return path;
 }
@@ -500,7 +666,7 @@ std::list<Route::Step> PlayerWorldPathfinder::buildPath( const int targetIndex )
 void PlayerWorldPathfinder::processCurrentNode( std::vector<int> & nodesToExplore, const int currentNodeIdx )
 {
     const bool isFirstNode = ( currentNodeIdx == _pathStart );
-    const WorldNode & currentNode = _cache[currentNodeIdx];
+    const WorldNode & currentNode = getNode( currentNodeIdx );
     const bool fromWater = world.getTile( _pathStart ).isWater();
 
     if ( !isFirstNode && !isTileAvailableForWalkThrough( currentNodeIdx, fromWater ) ) {
@@ -523,7 +689,7 @@ void PlayerWorldPathfinder::processCurrentNode( std::vector<int> & nodesToExplor
             const uint32_t movementPenalty = getMovementPenalty( currentNodeIdx, monsterIndex, direction );
             const uint32_t movementCost = currentNode._cost + movementPenalty;
 
-            WorldNode & monsterNode = _cache[monsterIndex];
+            WorldNode & monsterNode = getNode( monsterIndex );
 
             if ( monsterNode._from == -1 || monsterNode._cost > movementCost ) {
                 monsterNode.update( currentNodeIdx, movementCost, subtractMovePoints( currentNode._remainingMovePoints, movementPenalty, maxMovePoints ) );
@@ -643,6 +809,9 @@ void AIWorldPathfinder::reEvaluateIfNeeded( const Heroes & hero )
 
         processWorldMap();
     }
+    else {
+        processWorldMapChanges();
+    }
 }
 
 void AIWorldPathfinder::reEvaluateIfNeeded( const int start, const PlayerColor color, const double armyStrength, const uint8_t skill )
@@ -659,54 +828,33 @@ void AIWorldPathfinder::reEvaluateIfNeeded( const int start, const PlayerColor c
 
         processWorldMap();
     }
+    else {
+        processWorldMapChanges();
+    }
 }
 
 bool AIWorldPathfinder::isTileAccessibleForAI( const int tileIndex )
 {
-    std::optional<bool> & isAccessible = _cache[tileIndex]._isAccessibleForAI;
-    if ( !isAccessible ) {
-        isAccessible = isTileAccessibleForAIWithArmy( tileIndex, _armyStrength, _minimalArmyStrengthAdvantage );
-    }
-
-    return *isAccessible;
+    return getCachedAIValue( getNode( tileIndex )._aiCacheFlags, WorldNode::IS_ACCESSIBLE_KNOWN, WorldNode::IS_ACCESSIBLE,
+                             [this, tileIndex]() { return isTileAccessibleForAIWithArmy( tileIndex, _armyStrength, _minimalArmyStrengthAdvantage ); } );
 }
 
 bool AIWorldPathfinder::isTileAvailableForWalkThroughForAI( const int tileIndex, const bool fromWater )
 {
-    std::optional<bool> & isAvailableForWalkThrough
-        = fromWater ? _cache[tileIndex]._isAvailableForWalkThroughForAI.fromWater : _cache[tileIndex]._isAvailableForWalkThroughForAI.fromLand;
-    if ( !isAvailableForWalkThrough ) {
-        isAvailableForWalkThrough = isTileAvailableForWalkThroughForAIWithArmy( tileIndex, fromWater, _color, _isArtifactsBagFull, _isEquippedWithSpellBook,
-                                                                                _armyStrength, _minimalArmyStrengthAdvantage );
-    }
+    const uint8_t knownFlag = fromWater ? WorldNode::IS_AVAILABLE_FOR_WALK_THROUGH_FROM_WATER_KNOWN : WorldNode::IS_AVAILABLE_FOR_WALK_THROUGH_FROM_LAND_KNOWN;
+    const uint8_t valueFlag = fromWater ? WorldNode::IS_AVAILABLE_FOR_WALK_THROUGH_FROM_WATER : WorldNode::IS_AVAILABLE_FOR_WALK_THROUGH_FROM_LAND;
 
-    return *isAvailableForWalkThrough;
+    return getCachedAIValue( getNode( tileIndex )._aiCacheFlags, knownFlag, valueFlag, [this, tileIndex, fromWater]() {
+        return isTileAvailableForWalkThroughForAIWithArmy( tileIndex, fromWater, _color, _isArtifactsBagFull, _isEquippedWithSpellBook, _armyStrength,
+                                                           _minimalArmyStrengthAdvantage );
+    } );
 }
 
 void AIWorldPathfinder::processWorldMap()
 {
     assert( _cache.size() == world.getSize() && Maps::isValidAbsIndex( _pathStart ) );
 
-    for ( WorldNode & node : _cache ) {
-        node = {};
-    }
-
-    _cache[_pathStart].update( -1, 0, _remainingMovePoints );
-
-    std::vector<int> nodesToExplore;
-    nodesToExplore.push_back( _pathStart );
-
-    const auto processTownPortal = [this, &nodesToExplore]( const Spell & spell, const int32_t castleIndex ) {
-        assert( castleIndex >= 0 && static_cast<size_t>( castleIndex ) < _cache.size() );
-        assert( castleIndex != _pathStart && _cache[castleIndex]._from == -1 );
-
-        const uint32_t cost = spell.movePoints();
-        const uint32_t remaining = ( _remainingMovePoints < cost ) ? 0 : _remainingMovePoints - cost;
-
-        _cache[castleIndex].update( _pathStart, cost, remaining );
-
-        nodesToExplore.push_back( castleIndex );
-    };
+    startNewGeneration();
 
     if ( _townGateCastleIndex != -1 ) {
         processTownPortal( Spell::TOWNGATE, _townGateCastleIndex );
@@ -720,11 +868,44 @@ void AIWorldPathfinder::processWorldMap()
         processTownPortal( Spell::TOWNPORTAL, idx );
     }
 
-    for ( size_t lastProcessedNode = 0; lastProcessedNode < nodesToExplore.size(); ++lastProcessedNode ) {
-        processCurrentNode( nodesToExplore, nodesToExplore[lastProcessedNode] );
+    for ( size_t lastProcessedNode = 0; lastProcessedNode < _nodesToExplore.size(); ++lastProcessedNode ) {
+        processCurrentNode( _nodesToExplore, _nodesToExplore[lastProcessedNode] );
     }
 }
 
+void AIWorldPathfinder::reconnectInvalidatedNode( const int nodeIdx )
+{
+    if ( nodeIdx == _townGateCastleIndex ) {
+        processTownPortal( Spell::TOWNGATE, nodeIdx );
+    }
+    else if ( std::find( _townPortalCastleIndexes.begin(), _townPortalCastleIndexes.end(), nodeIdx ) != _townPortalCastleIndexes.end() ) {
+        processTownPortal( Spell::TOWNPORTAL, nodeIdx );
+    }
+
+    // The list of endpoints of a teleport consists of the tiles which lead to this teleport as well
+    MapsIndexes teleports = world.GetTeleportEndPoints( nodeIdx );
+    if ( teleports.empty() ) {
+        teleports = world.GetWhirlpoolEndPoints( nodeIdx );
+    }
+
+    for ( const int teleportIdx : teleports ) {
+        addRepairSeed( teleportIdx );
+    }
+}
+
+void AIWorldPathfinder::processTownPortal( const Spell & spell, const int32_t castleIndex )
+{
+    WorldNode & castleNode = getNode( castleIndex );
+    assert( castleIndex != _pathStart && castleNode._from == -1 );
+
+    const uint32_t cost = spell.movePoints();
+    const uint32_t remaining = ( _remainingMovePoints < cost ) ? 0 : _remainingMovePoints - cost;
+
+    castleNode.update( _pathStart, cost, remaining );
+
+    _nodesToExplore.push_back( castleIndex );
+}
+
 bool AIWorldPathfinder::isMovementAllowed( const int from, const int direction ) const
 {
     return isMovementAllowedForColor( from, direction, _color, false, _isSummonBoatSpellAvailable );
@@ -733,7 +914,7 @@ bool AIWorldPathfinder::isMovementAllowed( const int from, const int direction )
 void AIWorldPathfinder::processCurrentNode( std::vector<int> & nodesToExplore, const int currentNodeIdx )
 {
     const bool isFirstNode = ( currentNodeIdx == _pathStart );
-    WorldNode & currentNode = _cache[currentNodeIdx];
+    WorldNode & currentNode = getNode( currentNodeIdx );
 
     // Always allow movement from the starting point to cover the edge case where we got here before this tile became blocked
     if ( !isFirstNode ) {
@@ -786,7 +967,7 @@ void AIWorldPathfinder::processCurrentNode( std::vector<int> & nodesToExplore, c
                 continue;
             }
 
-            WorldNode & teleportNode = _cache[teleportIdx];
+            WorldNode & teleportNode = getNode( teleportIdx );
 
             // Check if the movement is really faster via teleport
             if ( teleportNode._from == -1 || teleportNode._cost > currentNode._cost ) {
@@ -827,7 +1008,7 @@ uint32_t AIWorldPathfinder::getMovementPenalty( const int from, const int to, co
             return regularPenalty;
         }
 
-        const WorldNode & node = _cache[from];
+        const WorldNode & node = getNode( from );
 
         // No dead ends allowed
         assert( node._from != -1 );
@@ -857,7 +1038,7 @@ uint32_t AIWorldPathfinder::getMovementPenalty( const int from, const int to, co
     // If we perform pathfinding for a real AI-controlled hero on the map, we should correctly calculate
     // movement penalties when this hero overcomes water obstacles using boats.
     if ( maxMovePoints > 0 ) {
-        const WorldNode & node = _cache[from];
+        const WorldNode & node = getNode( from );
 
         // No dead ends allowed
         assert( from == _pathStart || node._from != -1 );
@@ -900,12 +1081,13 @@ std::pair<int32_t, bool> AIWorldPathfinder::getFogDiscoveryTile( const Heroes &
         TileCharacteristics bestTile;
 
         for ( size_t idx = 0; idx < _cache.size(); ++idx ) {
-            const uint32_t nodeCost = _cache[idx]._cost;
+            const int32_t tileIdx = static_cast<int32_t>( idx );
+
+            const uint32_t nodeCost = getNode( tileIdx )._cost;
             if ( nodeCost == 0 ) {
                 continue;
             }
 
-            const int32_t tileIdx = static_cast<int32_t>( idx );
             if ( !MP2::isSafeForFogDiscoveryObject( world.getTile( tileIdx ).getMainObjectType( true ) ) ) {
                 continue;
             }
@@ -947,7 +1129,7 @@ std::pair<int32_t, bool> AIWorldPathfinder::getFogDiscoveryTile( const Heroes &
 
     // First, consider the accessible tiles, one of the neighboring tiles of which is covered with fog. Most likely, some of these neighboring tiles are also accessible.
     {
-        const int32_t bestTileIdx = findBestTile( [this]( const int32_t tileIdx ) { return world.getTile( tileIdx ).isFog( _color ); } );
+        const int32_t bestTileIdx = findBestTile( [this, &fog = world.getFog()]( const int32_t tileIdx ) { return fog.isFog( tileIdx, _color ); } );
         if ( bestTileIdx != -1 ) {
             return { bestTileIdx, true };
         }
@@ -956,7 +1138,7 @@ std::pair<int32_t, bool> AIWorldPathfinder::getFogDiscoveryTile( const Heroes &
     // If we are unlucky, then we need to do the heavy lifting and consider the accessible tiles that have at least one neighboring tile that is inaccessible to the hero
     // (since there may be unexplored tiles covered with fog on the other side of such an obstacle).
     {
-        const int32_t bestTileIdx = findBestTile( [this]( const int32_t tileIdx ) { return _cache[tileIdx]._cost == 0; } );
+        const int32_t bestTileIdx = findBestTile( [this]( const int32_t tileIdx ) { return getNode( tileIdx )._cost == 0; } );
         if ( bestTileIdx != -1 ) {
             return { bestTileIdx, false };
         }
@@ -991,7 +1173,7 @@ int AIWorldPathfinder::getNearestTileToMove( const Heroes & hero )
             continue;
         }
 
-        const WorldNode & node = _cache[newIndex];
+        const WorldNode & node = getNode( newIndex );
 
         // Tile is directly reachable (in one move) and the hero has enough army to defeat potential guards
         if ( node._cost > 0 && node._from == start ) {
@@ -1165,15 +1347,13 @@ std::vector<IndexObject> AIWorldPathfinder::getObjectsOnTheWay( const int target
 
     std::vector<IndexObject> result;
 
-    // Destination is not reachable
-    if ( _cache[targetIndex]._cost == 0 ) {
-        return result;
-    }
-
     const Kingdom & kingdom = world.GetKingdom( _color );
     std::set<int> uniqueIndices;
 
-    const auto validateAndAdd = [&kingdom, &result, &uniqueIndices]( const int index ) {
+    // skip the target itself to make sure we don't double count
+    uniqueIndices.insert( targetIndex );
+
+    forEachPathStepBackwards( targetIndex, [&kingdom, &result, &uniqueIndices]( const int index, const int /* from */ ) {
         // std::set insert returns a pair, second value is true if it was unique.
         if ( !uniqueIndices.insert( index ).second ) {
             return;
@@ -1184,36 +1364,12 @@ std::vector<IndexObject> AIWorldPathfinder::getObjectsOnTheWay( const int target
         if ( AI::isValuableAdventureMapObject( kingdom, objectType, index ) ) {
             result.emplace_back( index, objectType );
         }
-    };
-
-    // skip the target itself to make sure we don't double count
-    uniqueIndices.insert( targetIndex );
-
-#ifndef NDEBUG
-    std::set<int> uniqPathIndexes;
-#endif
-
-    int currentNode = targetIndex;
-
-    while ( currentNode != _pathStart ) {
-        assert( currentNode != -1 );
-
-        const int from = _cache[currentNode]._from;
-
-        assert( from != -1 );
-
-        validateAndAdd( currentNode );
-
-        // The path should not pass through the same tile more than once
-        assert( uniqPathIndexes.insert( from ).second );
-
-        currentNode = from;
-    }
+    } );
 
     return result;
 }
 
-std::list<Route::Step> AIWorldPathfinder::buildDimensionDoorPath( const int targetIndex )
+std::vector<Route::Step> AIWorldPathfinder::buildDimensionDoorPath( const int targetIndex )
 {
     assert( Maps::isValidAbsIndex( _pathStart ) && Maps::isValidAbsIndex( targetIndex ) );
 
@@ -1271,7 +1427,8 @@ std::list<Route::Step> AIWorldPathfinder::buildDimensionDoorPath( const int targ
     const uint32_t maxCasts = std::min( { remainingSpellPoints / _dimensionDoorSPCost, _remainingMovePoints / dimensionDoorMovementCost, difficultyLimit } );
     const auto & directions = Direction::allNeighboringDirections;
 
-    std::list<Route::Step> path;
+    std::vector<Route::Step> path;
+    path.reserve( maxCasts );
 
     for ( uint32_t spellsUsed = 0; spellsUsed < maxCasts; ++spellsUsed ) {
         const int32_t currentNodeIdx = Maps::GetIndexFromAbsPoint( current );
@@ -1342,46 +1499,27 @@ std::list<Route::Step> AIWorldPathfinder::buildDimensionDoorPath( const int targ
     return {};
 }
 
-std::list<Route::Step> AIWorldPathfinder::buildPath( const int targetIndex, const bool accountNearestObject ) const
+std::vector<Route::Step> AIWorldPathfinder::buildPath( const int targetIndex, const bool accountNearestObject ) const
 {
     assert( _cache.size() == world.getSize() && Maps::isValidAbsIndex( _pathStart ) && Maps::isValidAbsIndex( targetIndex ) );
 
-    std::list<Route::Step> path;
-
-    // Destination is not reachable
-    if ( _cache[targetIndex]._cost == 0 ) {
-        return path;
-    }
+    std::vector<Route::Step> path;
 
     const bool fromWater = world.getTile( _pathStart ).isWater();
 
-#ifndef NDEBUG
-    std::set<int> uniqPathIndexes;
-#endif
-
     int lastValidNode = targetIndex;
-    int currentNode = targetIndex;
-
-    while ( currentNode != _pathStart ) {
-        assert( currentNode != -1 );
 
+    forEachPathStepBackwards( targetIndex, [this, accountNearestObject, fromWater, &path, &lastValidNode]( const int currentNode, const int from ) {
         if ( accountNearestObject && !isTileAvailableForWalkThrough( currentNode, fromWater ) ) {
             lastValidNode = currentNode;
         }
 
-        const WorldNode & node = _cache[currentNode];
-
-        assert( node._from != -1 );
-
-        const uint32_t cost = node._cost - _cache[node._from]._cost;
+        const uint32_t cost = getNode( currentNode )._cost - getNode( from )._cost;
 
-        path.emplace_front( currentNode, node._from, Maps::GetDirection( node._from, currentNode ), cost );
+        path.emplace_back( currentNode, from, Maps::GetDirection( from, currentNode ), cost );
+    } );
 
-        // The path should not pass through the same tile more than once
-        assert( uniqPathIndexes.insert( node._from ).second );
-
-        currentNode = node._from;
-    }
+    std::reverse( path.begin(), path.end() );
 
     // Cut the path to the last valid tile/obstacle
     if ( lastValidNode != targetIndex ) {
@@ -1396,9 +1534,7 @@ uint32_t AIWorldPathfinder::getDistance( const int start, const int targetIndex,
 {
     reEvaluateIfNeeded( start, color, armyStrength, skill );
 
-    assert( targetIndex >= 0 && static_cast<size_t>( targetIndex ) < _cache.size() );
-
-    return _cache[targetIndex]._cost;
+    return getNode( targetIndex )._cost;
 }
 
 void AIWorldPathfinder::setMinimalArmyStrengthAdvantage( const double advantage )
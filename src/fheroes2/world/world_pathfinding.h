@@ -20,17 +20,22 @@
 
 #pragma once
 
+#include <cassert>
+#include <cstddef>
 #include <cstdint>
-#include <list>
-#include <optional>
 #include <utility>
 #include <vector>
 
+#ifndef NDEBUG
+#include <set>
+#endif
+
 #include "color.h"
 #include "skill.h"
 
 class Heroes;
 class IndexObject;
+class Spell;
 
 namespace Route
 {
@@ -39,20 +44,27 @@ namespace Route
 
 struct WorldNode final
 {
+    // When calculating tile availability for an AI-controlled player, various relatively heavy computations are
+    // performed, the result of which does not depend on the direction in which the tile is entered. The results
+    // of these calculations are cached as pairs of bits: whether the value has been calculated and the value itself.
+    enum AICacheFlag : uint8_t
+    {
+        IS_ACCESSIBLE_KNOWN = 0x01,
+        IS_ACCESSIBLE = 0x02,
+        IS_AVAILABLE_FOR_WALK_THROUGH_FROM_WATER_KNOWN = 0x04,
+        IS_AVAILABLE_FOR_WALK_THROUGH_FROM_WATER = 0x08,
+        IS_AVAILABLE_FOR_WALK_THROUGH_FROM_LAND_KNOWN = 0x10,
+        IS_AVAILABLE_FOR_WALK_THROUGH_FROM_LAND = 0x20
+    };
+
     int _from{ -1 };
     uint32_t _cost{ 0 };
     // The number of movement points remaining for the hero after moving to this node
     uint32_t _remainingMovePoints{ 0 };
-
-    // When calculating tile availability for an AI-controlled player, various relatively heavy computations are
-    // performed, the result of which does not depend on the direction in which the tile is entered. The results
-    // of these calculations can be cached.
-    std::optional<bool> _isAccessibleForAI;
-    struct
-    {
-        std::optional<bool> fromWater;
-        std::optional<bool> fromLand;
-    } _isAvailableForWalkThroughForAI;
+    // The generation of the pathfinder cache this node belongs to. Nodes from older generations are considered to be
+    // in the default state, which allows to reset the whole cache without touching every node.
+    uint32_t _generation{ 0 };
+    uint8_t _aiCacheFlags{ 0 };
 
     WorldNode() = default;
 
@@ -63,6 +75,7 @@ struct WorldNode final
         _remainingMovePoints = remainingMovePoints;
     }
 
+    // Resets the path information but keeps the cached AI checks as they do not depend on the path.
     void reset()
     {
         _from = -1;
@@ -86,11 +99,95 @@ public:
 
     uint32_t getDistance( int targetIndex ) const;
 
+    // Calls function( tileIndex, fromIndex ) for every step of the path to the tile with the index 'targetIndex', starting from the
+    // last step, without building the path. If the destination tile is not reachable, then the function is not called at all.
+    template <typename Function>
+    void forEachPathStepBackwards( const int targetIndex, Function function ) const
+    {
+        assert( _pathStart >= 0 && static_cast<size_t>( _pathStart ) < _cache.size() );
+
+        // Destination is not reachable
+        if ( getNode( targetIndex )._cost == 0 ) {
+            return;
+        }
+
+#ifndef NDEBUG
+        std::set<int> uniqPathIndexes;
+#endif
+
+        int currentNode = targetIndex;
+
+        while ( currentNode != _pathStart ) {
+            assert( currentNode != -1 );
+
+            const int from = getNode( currentNode )._from;
+
+            assert( from != -1 );
+
+            function( currentNode, from );
+
+            // The path should not pass through the same tile more than once
+            assert( uniqPathIndexes.insert( from ).second );
+
+            currentNode = from;
+        }
+    }
+
+    // Notifies the pathfinder that the state of the given tile has been changed. The next re-evaluation with the same
+    // settings repairs only the nodes whose paths depend on the changed tiles instead of processing the whole map.
+    void invalidateTile( const int tileIndex );
+
 protected:
     void checkAdjacentNodes( std::vector<int> & nodesToExplore, const int currentNodeIdx );
 
     virtual void processWorldMap();
 
+    // Repairs the cache after the changes of the tiles passed to invalidateTile(), if there were any.
+    void processWorldMapChanges();
+
+    // Restores the connections of an invalidated node which are not based on the adjacency of tiles (e.g. teleports).
+    // The default implementation does nothing and can be overridden by a derived class.
+    virtual void reconnectInvalidatedNode( const int /* nodeIdx */ )
+    {
+        // Do nothing.
+    }
+
+    // Adds the given node to the list of nodes to explore during the repair of the cache if this node is reachable
+    // and does not depend on the changed tiles.
+    void addRepairSeed( const int nodeIdx );
+
+    // Invalidates all nodes of the cache in constant time and prepares the list of nodes to explore, starting from
+    // the start tile of the path.
+    void startNewGeneration();
+
+    // Returns the node of the tile with the given index. Nodes which were not updated since the last call of
+    // startNewGeneration() are returned in their default state.
+    const WorldNode & getNode( const int index ) const
+    {
+        assert( index >= 0 && static_cast<size_t>( index ) < _cache.size() );
+
+        const WorldNode & node = _cache[index];
+        if ( node._generation == _generation ) {
+            return node;
+        }
+
+        static const WorldNode emptyNode;
+        return emptyNode;
+    }
+
+    WorldNode & getNode( const int index )
+    {
+        assert( index >= 0 && static_cast<size_t>( index ) < _cache.size() );
+
+        WorldNode & node = _cache[index];
+        if ( node._generation != _generation ) {
+            node = {};
+            node._generation = _generation;
+        }
+
+        return node;
+    }
+
     // Checks whether moving from the source tile in the specified direction is allowed. The default implementation
     // can be overridden by a derived class.
     virtual bool isMovementAllowed( const int from, const int direction ) const;
@@ -112,6 +209,18 @@ protected:
     std::vector<WorldNode> _cache;
     std::vector<int> _mapOffset;
 
+    // The list of nodes to explore is kept between re-evaluations so that its memory is allocated only once.
+    std::vector<int> _nodesToExplore;
+
+    uint32_t _generation{ 0 };
+
+    // Tiles changed since the last evaluation of the cache.
+    std::vector<int> _changedTiles;
+
+    // Temporary data used to repair the cache, kept between repairs so that its memory is allocated only once.
+    std::vector<uint8_t> _nodeRepairStates;
+    std::vector<int> _nodesToRepair;
+
     // The hero properties used by the pathfinder are cached here not just for optimization, but also because some
     // of them may change even if the position of the hero does not change, so it should be possible to compare the
     // old values with the new ones to determine whether the pathfinder cache needs to be recalculated.
@@ -137,7 +246,7 @@ public:
 
     // Builds and returns a path to the tile with the index 'targetIndex'. If the destination tile is not reachable,
     // then an empty path is returned.
-    std::list<Route::Step> buildPath( const int targetIndex ) const;
+    std::vector<Route::Step> buildPath( const int targetIndex ) const;
 
 private:
     // Follows regular passability rules (for the human player)
@@ -186,12 +295,12 @@ public:
     // Dimension Door spell to move between them. If the target tile is unsuitable for moving to it using the Dimension Door
     // spell, but there is a tile suitable for this next to it, from which it is possible to move to the target tile, then the
     // resulting path will end with this neighboring tile. If such a path could not be built, then an empty path is returned.
-    std::list<Route::Step> buildDimensionDoorPath( const int targetIndex );
+    std::vector<Route::Step> buildDimensionDoorPath( const int targetIndex );
 
     // Builds and returns a path to the tile with the index 'targetIndex'.
     // If there is a need to pass through any objects on the way to this tile and accountNearestObject is set, then a path to the nearest such object is returned.
     // If the destination tile is not reachable in principle, then an empty path is returned.
-    std::list<Route::Step> buildPath( const int targetIndex, const bool accountNearestObject ) const;
+    std::vector<Route::Step> buildPath( const int targetIndex, const bool accountNearestObject ) const;
 
     // Used for non-hero armies, like castles or monsters
     uint32_t getDistance( const int start, const int targetIndex, const PlayerColor color, const double armyStrength, const uint8_t skill = Skill::Level::EXPERT );
@@ -226,6 +335,12 @@ private:
 
     void processWorldMap() override;
 
+    // Restores the paths to the castles reachable by Town Gate or Town Portal spells as well as paths via teleports
+    void reconnectInvalidatedNode( const int nodeIdx ) override;
+
+    // Makes the given castle reachable from the start tile using the given spell
+    void processTownPortal( const Spell & spell, const int32_t castleIndex );
+
     // Adds special logic for AI-controlled heroes to use Summon Boat spell to overcome water obstacles (if available)
     bool isMovementAllowed( const int from, const int direction ) const override;
 
@@ -0,0 +1,329 @@
+/***************************************************************************
+ *   fheroes2: https://github.com/ihhub/fheroes2                           *
+ *   Copyright (C) 2026                                                    *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "image.h"
+#include "image_kernels.h"
+#include "rand.h"
+#include "system.h"
+#include "timing.h"
+
+namespace
+{
+    // Each kernel is run at least this amount of time to get stable results.
+    constexpr double minimumMeasurementTimeS = 0.25;
+
+    struct Kernel
+    {
+        std::string name;
+        std::function<void( const fheroes2::Image & sprite )> run;
+    };
+
+    // Generates an image similar to game sprites: an opaque ellipse surrounded by transparent pixels with a shadow in its bottom-left part.
+    fheroes2::Image generateSprite( const int32_t width, const int32_t height, Rand::PCG32 & randomGenerator )
+    {
+        fheroes2::Image sprite( width, height );
+        sprite.reset();
+
+        uint8_t * image = sprite.image();
+        uint8_t * transform = sprite.transform();
+
+        const double halfWidth = width / 2.0;
+        const double halfHeight = height / 2.0;
+
+        for ( int32_t y = 0; y < height; ++y ) {
+            for ( int32_t x = 0; x < width; ++x, ++image, ++transform ) {
+                const double dx = ( x + 0.5 - halfWidth ) / halfWidth;
+                const double dy = ( y + 0.5 - halfHeight ) / halfHeight;
+                const double distance = dx * dx + dy * dy;
+
+                if ( distance < 0.8 ) {
+                    *image = static_cast<uint8_t>( Rand::GetWithGen( 10, 213, randomGenerator ) );
+                    *transform = 0;
+                }
+                else if ( distance < 1.0 && dx < 0 && dy > 0 ) {
+                    *transform = 3;
+                }
+            }
+        }
+
+        return sprite;
+    }
+
+    double measureMegapixelsPerSecond( const Kernel & kernel, const fheroes2::Image & sprite )
+    {
+        // Warm up caches before the measurement.
+        kernel.run( sprite );
+
+        uint64_t callCount = 0;
+        double elapsedTime = 0;
+
+        const fheroes2::Time timer;
+        do {
+            for ( int i = 0; i < 16; ++i ) {
+                kernel.run( sprite );
+            }
+
+            callCount += 16;
+            elapsedTime = timer.getS();
+        } while ( elapsedTime < minimumMeasurementTimeS );
+
+        return static_cast<double>( callCount ) * sprite.width() * sprite.height() / elapsedTime / 1000000;
+    }
+
+    // The number of random rows checked for every row width and transform pattern.
+    constexpr int verificationRowCount = 8;
+
+    // Rows are surrounded by random pixels on both sides to detect writes outside of them.
+    constexpr int32_t rowPadding = 64;
+
+    enum class TransformPattern : uint8_t
+    {
+        // Only copied and skipped pixels so every chunk takes the vector path.
+        COPY_AND_SKIP,
+        // Mostly copied and skipped pixels with rare shadows, like in game sprites.
+        RARE_EFFECTS,
+        // Any transform values so most chunks fall back to the scalar path.
+        RANDOM
+    };
+
+    uint8_t generateTransform( const TransformPattern pattern, Rand::PCG32 & randomGenerator )
+    {
+        switch ( pattern ) {
+        case TransformPattern::COPY_AND_SKIP:
+            return static_cast<uint8_t>( Rand::GetWithGen( 0, 1, randomGenerator ) );
+        case TransformPattern::RARE_EFFECTS:
+            if ( Rand::GetWithGen( 0, 63, randomGenerator ) == 0 ) {
+                return static_cast<uint8_t>( Rand::GetWithGen( 2, 15, randomGenerator ) );
+            }
+            return static_cast<uint8_t>( Rand::GetWithGen( 0, 1, randomGenerator ) );
+        case TransformPattern::RANDOM:
+        default:
+            break;
+        }
+
+        return static_cast<uint8_t>( Rand::GetWithGen( 0, 15, randomGenerator ) );
+    }
+
+    struct RowData
+    {
+        std::vector<uint8_t> imageIn;
+        std::vector<uint8_t> transformIn;
+        std::vector<uint8_t> imageOut;
+        std::vector<uint8_t> transformOut;
+    };
+
+    // Runs the row blit kernel of the current instruction set on a copy of the output layers including their padding.
+    void runBlitRow( const RowData & row, const int32_t width, const std::vector<uint8_t> & transformTable, const bool isFlipped, const bool hasTransformOut,
+                     std::vector<uint8_t> & imageOut, std::vector<uint8_t> & transformOut )
+    {
+        imageOut = row.imageOut;
+        transformOut = row.transformOut;
+
+        // Flipped rows are read backwards starting from the rightmost pixel.
+        const ptrdiff_t inOffset = isFlipped ? rowPadding + width - 1 : rowPadding;
+
+        fheroes2::blitRow( row.imageIn.data() + inOffset, row.transformIn.data() + inOffset, imageOut.data() + rowPadding,
+                           hasTransformOut ? transformOut.data() + rowPadding : nullptr, width, transformTable.data(), isFlipped );
+    }
+
+    // Checks that every supported vector instruction set produces exactly the same results as the scalar kernels on random rows.
+    bool verifyKernels()
+    {
+        std::vector<fheroes2::InstructionSet> vectorInstructionSets;
+        for ( const fheroes2::InstructionSet instructionSet : { fheroes2::InstructionSet::SSE2, fheroes2::InstructionSet::AVX2, fheroes2::InstructionSet::NEON } ) {
+            if ( fheroes2::isInstructionSetSupported( instructionSet ) ) {
+                vectorInstructionSets.push_back( instructionSet );
+            }
+        }
+
+        if ( vectorInstructionSets.empty() ) {
+            std::cout << "No vector instruction sets are supported, there is nothing to verify." << std::endl;
+            return true;
+        }
+
+        Rand::PCG32 randomGenerator( 0 );
+
+        std::vector<uint8_t> transformTable( 256 * 16 );
+        for ( uint8_t & value : transformTable ) {
+            value = static_cast<uint8_t>( Rand::GetWithGen( 0, 255, randomGenerator ) );
+        }
+
+        std::vector<uint32_t> palette( 256 );
+        for ( uint32_t & value : palette ) {
+            value = Rand::GetWithGen( 0, UINT32_MAX, randomGenerator );
+        }
+
+        // Every tail length for all vector widths (up to 32 pixels for AVX2) including empty rows, and a few typical sprite sizes.
+        std::vector<int32_t> widths;
+        for ( int32_t width = 0; width <= 100; ++width ) {
+            widths.push_back( width );
+        }
+        for ( const int32_t width : { 127, 128, 129, 255, 256, 257, 640 } ) {
+            widths.push_back( width );
+        }
+
+        bool isIdentical = true;
+
+        std::vector<uint8_t> expectedImage;
+        std::vector<uint8_t> expectedTransform;
+        std::vector<uint8_t> image;
+        std::vector<uint8_t> transform;
+        std::vector<uint32_t> expectedPixels;
+        std::vector<uint32_t> pixels;
+
+        for ( const int32_t width : widths ) {
+            const size_t paddedWidth = static_cast<size_t>( width ) + 2 * rowPadding;
+
+            for ( const TransformPattern pattern : { TransformPattern::COPY_AND_SKIP, TransformPattern::RARE_EFFECTS, TransformPattern::RANDOM } ) {
+                for ( int rowId = 0; rowId < verificationRowCount; ++rowId ) {
+                    RowData row;
+                    row.imageIn.resize( paddedWidth );
+                    row.transformIn.resize( paddedWidth );
+                    row.imageOut.resize( paddedWidth );
+                    row.transformOut.resize( paddedWidth );
+
+                    for ( size_t i = 0; i < paddedWidth; ++i ) {
+                        row.imageIn[i] = static_cast<uint8_t>( Rand::GetWithGen( 0, 255, randomGenerator ) );
+                        row.transformIn[i] = generateTransform( pattern, randomGenerator );
+                        row.imageOut[i] = static_cast<uint8_t>( Rand::GetWithGen( 0, 255, randomGenerator ) );
+                        row.transformOut[i] = generateTransform( pattern, randomGenerator );
+                    }
+
+                    for ( const bool isFlipped : { false, true } ) {
+                        for ( const bool hasTransformOut : { false, true } ) {
+                            fheroes2::setImageInstructionSet( fheroes2::InstructionSet::SCALAR );
+                            runBlitRow( row, width, transformTable, isFlipped, hasTransformOut, expectedImage, expectedTransform );
+
+                            for ( const fheroes2::InstructionSet instructionSet : vectorInstructionSets ) {
+                                fheroes2::setImageInstructionSet( instructionSet );
+                                runBlitRow( row, width, transformTable, isFlipped, hasTransformOut, image, transform );
+
+                                if ( image != expectedImage || transform != expectedTransform ) {
+                                    std::cerr << "blitRow() mismatch for " << fheroes2::getInstructionSetName( instructionSet ) << ": width " << width
+                                              << ( isFlipped ? ", flipped" : "" ) << ( hasTransformOut ? ", two-layer output" : ", single-layer output" ) << std::endl;
+                                    isIdentical = false;
+                                }
+                            }
+                        }
+                    }
+
+                    expectedPixels.assign( paddedWidth, 0 );
+                    fheroes2::setImageInstructionSet( fheroes2::InstructionSet::SCALAR );
+                    fheroes2::expandPaletteRow( row.imageIn.data() + rowPadding, expectedPixels.data() + rowPadding, width, palette.data() );
+
+                    for ( const fheroes2::InstructionSet instructionSet : vectorInstructionSets ) {
+                        pixels.assign( paddedWidth, 0 );
+                        fheroes2::setImageInstructionSet( instructionSet );
+                        fheroes2::expandPaletteRow( row.imageIn.data() + rowPadding, pixels.data() + rowPadding, width, palette.data() );
+
+                        if ( pixels != expectedPixels ) {
+                            std::cerr << "expandPaletteRow() mismatch for " << fheroes2::getInstructionSetName( instructionSet ) << ": width " << width << std::endl;
+                            isIdentical = false;
+                        }
+                    }
+                }
+            }
+        }
+
+        if ( isIdentical ) {
+            std::cout << "All supported instruction sets produce results identical to the scalar kernels." << std::endl;
+        }
+
+        return isIdentical;
+    }
+}
+
+int main( int argc, char ** argv )
+{
+    const bool isVerification = ( argc == 2 && std::string( argv[1] ) == "--verify" );
+
+    if ( argc != 1 && !isVerification ) {
+        const std::string toolName = System::GetFileName( argv[0] );
+
+        std::cerr << toolName << " measures the performance of image processing kernels on typical sprite sizes for every supported instruction set." << std::endl
+                  << "Syntax: " << toolName << " [--verify]" << std::endl
+                  << "--verify: check that all supported instruction sets produce results identical to the scalar kernels instead of measuring performance."
+                  << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if ( isVerification ) {
+        return verifyKernels() ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    // The size of the game area in the original resolution.
+    fheroes2::Image background( 640, 480 );
+    background._disableTransformLayer();
+
+    fheroes2::Image paletteOutput;
+
+    std::vector<Kernel> kernels;
+    kernels.push_back( { "Blit", [&background]( const fheroes2::Image & sprite ) { fheroes2::Blit( sprite, background, 64, 64 ); } } );
+    kernels.push_back( { "Blit (flip)", [&background]( const fheroes2::Image & sprite ) { fheroes2::Blit( sprite, background, 64, 64, true ); } } );
+    kernels.push_back( { "AlphaBlit", [&background]( const fheroes2::Image & sprite ) { fheroes2::AlphaBlit( sprite, background, 64, 64, 128 ); } } );
+    kernels.push_back( { "ApplyPalette", [&paletteOutput]( const fheroes2::Image & sprite ) { fheroes2::ApplyPalette( sprite, paletteOutput, 2 ); } } );
+    kernels.push_back( { "ApplyTransform", [&background]( const fheroes2::Image & sprite ) {
+                            fheroes2::ApplyTransform( background, 64, 64, sprite.width(), sprite.height(), 3 );
+                        } } );
+    kernels.push_back( { "Copy", [&background]( const fheroes2::Image & sprite ) {
+                            fheroes2::Copy( sprite, 0, 0, background, 64, 64, sprite.width(), sprite.height() );
+                        } } );
+
+    Rand::PCG32 randomGenerator( 0 );
+
+    std::vector<fheroes2::Image> sprites;
+    // Adventure map tiles, heroes and small objects, battle monsters and large castle sprites.
+    for ( const int32_t size : { 32, 64, 128, 256 } ) {
+        sprites.emplace_back( generateSprite( size, size, randomGenerator ) );
+    }
+
+    std::cout << std::left << std::setw( 16 ) << "Kernel" << std::setw( 12 ) << "Size" << std::setw( 14 ) << "Instructions" << "Megapixels/s" << std::endl;
+
+    for ( const fheroes2::InstructionSet instructionSet :
+          { fheroes2::InstructionSet::SCALAR, fheroes2::InstructionSet::SSE2, fheroes2::InstructionSet::AVX2, fheroes2::InstructionSet::NEON } ) {
+        if ( !fheroes2::setImageInstructionSet( instructionSet ) ) {
+            continue;
+        }
+
+        for ( const Kernel & kernel : kernels ) {
+            for ( const fheroes2::Image & sprite : sprites ) {
+                background.fill( 0 );
+                paletteOutput.resize( sprite.width(), sprite.height() );
+
+                const std::string size = std::to_string( sprite.width() ) + "x" + std::to_string( sprite.height() );
+
+                std::cout << std::left << std::setw( 16 ) << kernel.name << std::setw( 12 ) << size << std::setw( 14 )
+                          << fheroes2::getInstructionSetName( instructionSet ) << std::fixed << std::setprecision( 1 ) << measureMegapixelsPerSecond( kernel, sprite )
+                          << std::endl;
+            }
+        }
+    }
+
+    return EXIT_SUCCESS;
+}